@@ -15,11 +15,46 @@
  */
 #include "build_service/analyzer/SingleWSTokenizer.h"
 
+#include <algorithm>
+#include <limits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 using namespace std;
 
 namespace build_service { namespace analyzer {
 BS_LOG_SETUP(analyzer, SingleWSTokenizer);
 
+namespace {
+inline bool isSpecialChar(unsigned char c)
+{
+    return c >= 0x80 || c == '&' || c == '+' || c == '\'' || c == '.' || c == '/' || c == ';';
+}
+
+inline bool isAlphaChar(unsigned char c) { return (c | 0x20) >= 'a' && (c | 0x20) <= 'z'; }
+
+inline bool isDigitChar(unsigned char c) { return c >= '0' && c <= '9'; }
+
+// end of the run of set bits starting at pos
+size_t findRunEnd(const vector<uint64_t>& mask, size_t pos, size_t len)
+{
+    size_t word = pos / 64;
+    uint64_t bits = ~mask[word] >> (pos % 64);
+    if (bits != 0) {
+        return min(len, pos + __builtin_ctzll(bits));
+    }
+    for (++word; word < mask.size(); ++word) {
+        if (~mask[word] != 0) {
+            return min(len, word * 64 + __builtin_ctzll(~mask[word]));
+        }
+    }
+    return len;
+}
+} // namespace
+
 SingleWSTokenizer::SingleWSTokenizer()
 {
     _scanner = NULL;
@@ -27,6 +62,9 @@ SingleWSTokenizer::SingleWSTokenizer()
     _pToken = NULL;
     _tokenLen = 0;
     _position = 0;
+    _text = NULL;
+    _fastCursor = 0;
+    _useFastPath = false;
 }
 
 SingleWSTokenizer::~SingleWSTokenizer() { clear(); }
@@ -40,13 +78,116 @@ void SingleWSTokenizer::clear()
 void SingleWSTokenizer::tokenize(const char* text, size_t len)
 {
     clear();
+    _position = 0;
+    _useFastPath = fastTokenize(text, len);
+    if (_useFastPath) {
+        return;
+    }
     _iss = new istringstream(string(text, len));
     _scanner = new SingleWSScanner(_iss, NULL);
     _position = 0;
 }
 
+bool SingleWSTokenizer::fastTokenize(const char* text, size_t len)
+{
+    if (len >= numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    size_t wordCount = (len + 63) / 64;
+    _alphaMask.assign(wordCount, 0);
+    _digitMask.assign(wordCount, 0);
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+    const __m256i alphaBegin = _mm256_set1_epi8('a' - 1);
+    const __m256i alphaEnd = _mm256_set1_epi8('z' + 1);
+    const __m256i digitBegin = _mm256_set1_epi8('0' - 1);
+    const __m256i digitEnd = _mm256_set1_epi8('9' + 1);
+    for (; i + 32 <= len; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(text + i));
+        __m256i special = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('&')),
+                            _mm256_cmpeq_epi8(block, _mm256_set1_epi8('+'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('\'')),
+                            _mm256_cmpeq_epi8(block, _mm256_set1_epi8(';'))));
+        special = _mm256_or_si256(special, _mm256_cmpeq_epi8(block, _mm256_set1_epi8('.')));
+        special = _mm256_or_si256(special, _mm256_cmpeq_epi8(block, _mm256_set1_epi8('/')));
+        if (_mm256_movemask_epi8(_mm256_or_si256(special, block)) != 0) {
+            return false;
+        }
+        __m256i lower = _mm256_or_si256(block, caseBit);
+        __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, alphaBegin), _mm256_cmpgt_epi8(alphaEnd, lower));
+        __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(block, digitBegin), _mm256_cmpgt_epi8(digitEnd, block));
+        _alphaMask[i / 64] |= (uint64_t)(uint32_t)_mm256_movemask_epi8(alpha) << (i % 64);
+        _digitMask[i / 64] |= (uint64_t)(uint32_t)_mm256_movemask_epi8(digit) << (i % 64);
+    }
+#elif defined(__SSE2__)
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    const __m128i alphaBegin = _mm_set1_epi8('a' - 1);
+    const __m128i alphaEnd = _mm_set1_epi8('z' + 1);
+    const __m128i digitBegin = _mm_set1_epi8('0' - 1);
+    const __m128i digitEnd = _mm_set1_epi8('9' + 1);
+    for (; i + 16 <= len; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(text + i));
+        __m128i special =
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('&')),
+                                      _mm_cmpeq_epi8(block, _mm_set1_epi8('+'))),
+                         _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\'')),
+                                      _mm_cmpeq_epi8(block, _mm_set1_epi8(';'))));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(block, _mm_set1_epi8('.')));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(block, _mm_set1_epi8('/')));
+        if (_mm_movemask_epi8(_mm_or_si128(special, block)) != 0) {
+            return false;
+        }
+        __m128i lower = _mm_or_si128(block, caseBit);
+        __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, alphaBegin), _mm_cmplt_epi8(lower, alphaEnd));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(block, digitBegin), _mm_cmplt_epi8(block, digitEnd));
+        _alphaMask[i / 64] |= (uint64_t)(uint32_t)_mm_movemask_epi8(alpha) << (i % 64);
+        _digitMask[i / 64] |= (uint64_t)(uint32_t)_mm_movemask_epi8(digit) << (i % 64);
+    }
+#endif
+    for (; i < len; ++i) {
+        unsigned char c = (unsigned char)text[i];
+        if (isSpecialChar(c)) {
+            return false;
+        }
+        if (isAlphaChar(c)) {
+            _alphaMask[i / 64] |= (uint64_t)1 << (i % 64);
+        } else if (isDigitChar(c)) {
+            _digitMask[i / 64] |= (uint64_t)1 << (i % 64);
+        }
+    }
+
+    _fastTokens.clear();
+    for (size_t pos = 0; pos < len;) {
+        size_t end = pos + 1;
+        if (_alphaMask[pos / 64] >> (pos % 64) & 1) {
+            end = findRunEnd(_alphaMask, pos, len);
+        } else if (_digitMask[pos / 64] >> (pos % 64) & 1) {
+            end = findRunEnd(_digitMask, pos, len);
+        }
+        _fastTokens.emplace_back((uint32_t)pos, (uint32_t)(end - pos));
+        pos = end;
+    }
+    _text = text;
+    _fastCursor = 0;
+    return true;
+}
+
 bool SingleWSTokenizer::next(Token& token)
 {
+    if (_useFastPath) {
+        if (_fastCursor >= _fastTokens.size()) {
+            return false;
+        }
+        const auto& fastToken = _fastTokens[_fastCursor++];
+        token.getNormalizedText().assign(_text + fastToken.first, fastToken.second);
+        token.setIsStopWord(false);
+        token.setPosition(_position);
+        token.setIsRetrieve(true);
+        _position++;
+        return true;
+    }
     if (!_scanner) {
         return false;
     }
@@ -16,6 +16,8 @@
 #ifndef ISEARCH_BS_SINGLEWSTOKENIZER_H
 #define ISEARCH_BS_SINGLEWSTOKENIZER_H
 
+#include <vector>
+
 #include "build_service/analyzer/SingleWSScanner.h"
 #include "build_service/analyzer/Tokenizer.h"
 #include "build_service/util/Log.h"
@@ -43,9 +45,19 @@ public:
 
 private:
     void clear();
+    // pure ascii text without [&+'./;] is split into letter runs, digit runs and single chars, same as the
+    // scanner, without going through flex. return false if the text needs the scanner.
+    bool fastTokenize(const char* text, size_t len);
 
 private:
     SingleWSScanner* _scanner;
+    // tokens of fast path as offset and length in _text, reused between texts
+    std::vector<std::pair<uint32_t, uint32_t>> _fastTokens;
+    std::vector<uint64_t> _alphaMask;
+    std::vector<uint64_t> _digitMask;
+    const char* _text;
+    size_t _fastCursor;
+    bool _useFastPath;
     std::istringstream* _iss;
     const char* _pToken;
     int _tokenLen;
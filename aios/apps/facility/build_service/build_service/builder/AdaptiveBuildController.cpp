@@ -0,0 +1,222 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "build_service/builder/AdaptiveBuildController.h"
+
+#include <algorithm>
+
+#include "autil/TimeUtility.h"
+#include "build_service/util/Monitor.h"
+#include "build_service/util/SystemLoadUtil.h"
+#include "indexlib/config/TabletOptions.h"
+#include "indexlib/framework/ITablet.h"
+#include "indexlib/framework/TabletInfos.h"
+#include "indexlib/framework/TabletMetrics.h"
+#include "indexlib/util/metrics/Metric.h"
+#include "indexlib/util/metrics/MetricProvider.h"
+
+using namespace std;
+using namespace autil;
+using namespace build_service::util;
+using autil::metric::QueryLatencyRecorder;
+
+namespace build_service::builder {
+BS_LOG_SETUP(builder, AdaptiveBuildController);
+
+#define LOG_PREFIX _logPrefix.c_str()
+
+AdaptiveBuildController::AdaptiveBuildController(const config::AdaptiveBuildConfig& config, const string& logPrefix)
+    : _config(config)
+    , _logPrefix(logPrefix)
+    , _limiter(new BuildRateLimiter)
+    , _cpuRunQueueEwma(-1)
+    , _cpuCount(SystemLoadUtil::getCpuCount())
+    , _lastTickTime(-1)
+    , _lastAcquiredDocCount(0)
+    , _lastThrottledTimeUs(0)
+    , _lastDecision(AD_HOLD)
+{
+    _lastLatencySnapshot.fill(0);
+}
+
+AdaptiveBuildController::~AdaptiveBuildController() {}
+
+void AdaptiveBuildController::init(const shared_ptr<indexlibv2::framework::ITablet>& tablet,
+                                   const shared_ptr<indexlib::util::MetricProvider>& metricProvider)
+{
+    _tablet = tablet;
+    _limiter->setRate(_config.maxDocsPerSecond);
+    QueryLatencyRecorder::getInstance()->snapshot(_lastLatencySnapshot);
+    _lastTickTime = TimeUtility::currentTime();
+    _lastAcquiredDocCount = _limiter->getAcquiredDocCount();
+    _lastThrottledTimeUs = _limiter->getThrottledTimeUs();
+
+    _targetDocsPerSecondMetric =
+        DECLARE_METRIC(metricProvider, "adaptiveBuild/targetDocsPerSecond", kmonitor::STATUS, "count");
+    _buildDocsPerSecondMetric =
+        DECLARE_METRIC(metricProvider, "adaptiveBuild/buildDocsPerSecond", kmonitor::STATUS, "count");
+    _throttledRatioMetric = DECLARE_METRIC(metricProvider, "adaptiveBuild/throttledRatio", kmonitor::STATUS, "%");
+    _queryLatencyP99Metric = DECLARE_METRIC(metricProvider, "adaptiveBuild/queryLatencyP99", kmonitor::STATUS, "ms");
+    _cpuRunQueueMetric = DECLARE_METRIC(metricProvider, "adaptiveBuild/cpuRunQueue", kmonitor::STATUS, "count");
+    _memoryUseRatioMetric = DECLARE_METRIC(metricProvider, "adaptiveBuild/memoryUseRatio", kmonitor::STATUS, "%");
+    _decisionMetric = DECLARE_METRIC(metricProvider, "adaptiveBuild/decision", kmonitor::STATUS, "count");
+
+    BS_PREFIX_LOG(INFO,
+                  "adaptive build control enabled, query p99 slo [%.1f]ms, cpu run queue slo [%.2f], "
+                  "memory use ratio slo [%.2f], docs per second [%.0f, %.0f]",
+                  _config.queryLatencyP99SloMs, _config.cpuRunQueueSlo, _config.memoryUseRatioSlo,
+                  _config.minDocsPerSecond, _config.maxDocsPerSecond);
+}
+
+void AdaptiveBuildController::stop() { _limiter->setRate(0); }
+
+void AdaptiveBuildController::tick()
+{
+    int64_t now = TimeUtility::currentTime();
+    int64_t interval = now - _lastTickTime;
+    if (interval <= 0) {
+        return;
+    }
+    int64_t acquiredDocCount = _limiter->getAcquiredDocCount();
+    int64_t throttledTimeUs = _limiter->getThrottledTimeUs();
+    double buildDocsPerSecond = (acquiredDocCount - _lastAcquiredDocCount) * 1000000.0 / interval;
+    double throttledRatio = min((throttledTimeUs - _lastThrottledTimeUs) * 1.0 / interval, 1.0);
+    _lastTickTime = now;
+    _lastAcquiredDocCount = acquiredDocCount;
+    _lastThrottledTimeUs = throttledTimeUs;
+
+    Signals signals;
+    collectSignals(signals);
+    double targetDocsPerSecond = _limiter->getRate();
+    Decision decision = decide(signals, buildDocsPerSecond, targetDocsPerSecond);
+    if (decision != AD_HOLD) {
+        _limiter->setRate(targetDocsPerSecond);
+    }
+    if (decision != _lastDecision && decision != AD_INCREASE) {
+        BS_PREFIX_LOG(INFO,
+                      "adaptive build [%s], target docs per second [%.0f], build docs per second [%.0f], "
+                      "query p99 [%.1f]ms of [%lu] queries, cpu run queue [%.2f], memory use ratio [%.2f]%s",
+                      decisionToStr(decision), targetDocsPerSecond, buildDocsPerSecond, signals.queryLatencyP99Ms,
+                      signals.querySampleCount, signals.cpuRunQueue, signals.memoryUseRatio,
+                      signals.reachMemoryLimit ? ", reach memory limit" : "");
+    }
+    _lastDecision = decision;
+    reportMetrics(signals, buildDocsPerSecond, throttledRatio, decision);
+}
+
+void AdaptiveBuildController::collectSignals(Signals& signals)
+{
+    QueryLatencyRecorder::Snapshot latencySnapshot;
+    QueryLatencyRecorder::getInstance()->snapshot(latencySnapshot);
+    signals.hasQueryLatency =
+        QueryLatencyRecorder::getQuantile(_lastLatencySnapshot, latencySnapshot, QUERY_LATENCY_QUANTILE,
+                                          _config.minQuerySampleCount, signals.queryLatencyP99Ms,
+                                          signals.querySampleCount);
+    if (signals.hasQueryLatency) {
+        // too few queries keep accumulating into the next tick
+        _lastLatencySnapshot = latencySnapshot;
+    }
+
+    uint32_t runningCount = 0;
+    if (SystemLoadUtil::getRunningThreadCount(runningCount)) {
+        double runQueue = (double)runningCount / _cpuCount;
+        _cpuRunQueueEwma = _cpuRunQueueEwma < 0 ? runQueue
+                                                : CPU_RUN_QUEUE_EWMA_WEIGHT * runQueue +
+                                                      (1 - CPU_RUN_QUEUE_EWMA_WEIGHT) * _cpuRunQueueEwma;
+        signals.hasCpuRunQueue = true;
+        signals.cpuRunQueue = _cpuRunQueueEwma;
+    }
+
+    auto tabletInfos = _tablet->GetTabletInfos();
+    auto tabletMetrics = tabletInfos->GetTabletMetrics();
+    int64_t buildMemoryQuota = _tablet->GetTabletOptions()->GetBuildMemoryQuota();
+    if (tabletMetrics && buildMemoryQuota > 0) {
+        signals.memoryUseRatio = (double)tabletMetrics->GetRtIndexMemsize() / buildMemoryQuota;
+    }
+    signals.reachMemoryLimit = tabletInfos->GetMemoryStatus() != indexlibv2::framework::MemoryStatus::OK;
+}
+
+AdaptiveBuildController::Decision AdaptiveBuildController::decide(const Signals& signals, double buildDocsPerSecond,
+                                                                  double& targetDocsPerSecond) const
+{
+    bool overload = signals.reachMemoryLimit;
+    bool healthy = !signals.reachMemoryLimit;
+    auto checkSignal = [&](bool hasSignal, double value, double slo) {
+        if (!hasSignal || slo <= 0) {
+            return;
+        }
+        overload = overload || value > slo;
+        healthy = healthy && value <= slo * _config.recoverRatio;
+    };
+    checkSignal(signals.hasQueryLatency, signals.queryLatencyP99Ms, _config.queryLatencyP99SloMs);
+    checkSignal(signals.hasCpuRunQueue, signals.cpuRunQueue, _config.cpuRunQueueSlo);
+    checkSignal(true, signals.memoryUseRatio, _config.memoryUseRatioSlo);
+
+    double currentRate = targetDocsPerSecond;
+    if (overload) {
+        // an unlimited builder backs off from the rate it really builds at
+        double baseRate = currentRate > 0 ? currentRate : buildDocsPerSecond;
+        targetDocsPerSecond = max(baseRate * _config.decreaseRatio, _config.minDocsPerSecond);
+        return targetDocsPerSecond == currentRate ? AD_HOLD : AD_DECREASE;
+    }
+    if (!healthy || currentRate <= 0) {
+        return AD_HOLD;
+    }
+    if (_config.maxDocsPerSecond > 0) {
+        targetDocsPerSecond = min(currentRate + _config.increaseDocsPerSecond, _config.maxDocsPerSecond);
+        return targetDocsPerSecond == currentRate ? AD_HOLD : AD_INCREASE;
+    }
+    if (currentRate > buildDocsPerSecond * UNLIMITED_HEADROOM) {
+        targetDocsPerSecond = 0;
+        return AD_UNLIMITED;
+    }
+    targetDocsPerSecond = currentRate + _config.increaseDocsPerSecond;
+    return AD_INCREASE;
+}
+
+void AdaptiveBuildController::reportMetrics(const Signals& signals, double buildDocsPerSecond, double throttledRatio,
+                                            Decision decision)
+{
+    REPORT_METRIC(_targetDocsPerSecondMetric, _limiter->getRate());
+    REPORT_METRIC(_buildDocsPerSecondMetric, buildDocsPerSecond);
+    REPORT_METRIC(_throttledRatioMetric, throttledRatio * 100);
+    if (signals.hasQueryLatency) {
+        REPORT_METRIC(_queryLatencyP99Metric, signals.queryLatencyP99Ms);
+    }
+    if (signals.hasCpuRunQueue) {
+        REPORT_METRIC(_cpuRunQueueMetric, signals.cpuRunQueue);
+    }
+    REPORT_METRIC(_memoryUseRatioMetric, signals.memoryUseRatio * 100);
+    REPORT_METRIC(_decisionMetric, (int32_t)decision);
+}
+
+const char* AdaptiveBuildController::decisionToStr(Decision decision)
+{
+    switch (decision) {
+    case AD_HOLD:
+        return "hold";
+    case AD_DECREASE:
+        return "decrease";
+    case AD_INCREASE:
+        return "increase";
+    case AD_UNLIMITED:
+        return "unlimited";
+    }
+    return "unknown";
+}
+
+#undef LOG_PREFIX
+
+} // namespace build_service::builder
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "autil/metric/QueryLatencyRecorder.h"
+#include "build_service/builder/BuildRateLimiter.h"
+#include "build_service/config/AdaptiveBuildConfig.h"
+#include "build_service/util/Log.h"
+
+namespace indexlib::util {
+class MetricProvider;
+class Metric;
+} // namespace indexlib::util
+
+namespace indexlibv2::framework {
+class ITablet;
+}
+
+namespace build_service::builder {
+
+// aimd controller of the realtime build rate. every tick it samples the query
+// p99 of the searchers in this process, the cpu run queue and the rt index
+// memory use against the build memory quota: any signal over its slo cuts the
+// rate by decreaseRatio, all signals comfortably below their slo grow it by
+// increaseDocsPerSecond, until the limiter no longer bounds the build.
+class AdaptiveBuildController
+{
+public:
+    enum Decision {
+        AD_HOLD = 0,
+        AD_DECREASE = 1,
+        AD_INCREASE = 2,
+        AD_UNLIMITED = 3,
+    };
+
+    struct Signals {
+        bool hasQueryLatency = false;
+        double queryLatencyP99Ms = 0;
+        uint64_t querySampleCount = 0;
+        bool hasCpuRunQueue = false;
+        double cpuRunQueue = 0;
+        double memoryUseRatio = 0;
+        bool reachMemoryLimit = false;
+    };
+
+public:
+    AdaptiveBuildController(const config::AdaptiveBuildConfig& config, const std::string& logPrefix);
+    ~AdaptiveBuildController();
+
+    AdaptiveBuildController(const AdaptiveBuildController&) = delete;
+    AdaptiveBuildController& operator=(const AdaptiveBuildController&) = delete;
+
+public:
+    void init(const std::shared_ptr<indexlibv2::framework::ITablet>& tablet,
+              const std::shared_ptr<indexlib::util::MetricProvider>& metricProvider);
+    void tick();
+    // release the limiter, builds blocked in it return at once
+    void stop();
+    const BuildRateLimiterPtr& getBuildRateLimiter() const { return _limiter; }
+
+private:
+    Decision decide(const Signals& signals, double buildDocsPerSecond, double& targetDocsPerSecond) const;
+    void collectSignals(Signals& signals);
+    void reportMetrics(const Signals& signals, double buildDocsPerSecond, double throttledRatio, Decision decision);
+    static const char* decisionToStr(Decision decision);
+
+private:
+    static constexpr double QUERY_LATENCY_QUANTILE = 0.99;
+    static constexpr double CPU_RUN_QUEUE_EWMA_WEIGHT = 0.3;
+    // a limiter this much faster than the real build rate no longer throttles anything
+    static constexpr double UNLIMITED_HEADROOM = 2.0;
+
+    config::AdaptiveBuildConfig _config;
+    std::string _logPrefix;
+    std::shared_ptr<indexlibv2::framework::ITablet> _tablet;
+    BuildRateLimiterPtr _limiter;
+    autil::metric::QueryLatencyRecorder::Snapshot _lastLatencySnapshot;
+    double _cpuRunQueueEwma;
+    uint32_t _cpuCount;
+    int64_t _lastTickTime;
+    int64_t _lastAcquiredDocCount;
+    int64_t _lastThrottledTimeUs;
+    Decision _lastDecision;
+
+    std::shared_ptr<indexlib::util::Metric> _targetDocsPerSecondMetric;
+    std::shared_ptr<indexlib::util::Metric> _buildDocsPerSecondMetric;
+    std::shared_ptr<indexlib::util::Metric> _throttledRatioMetric;
+    std::shared_ptr<indexlib::util::Metric> _queryLatencyP99Metric;
+    std::shared_ptr<indexlib::util::Metric> _cpuRunQueueMetric;
+    std::shared_ptr<indexlib::util::Metric> _memoryUseRatioMetric;
+    std::shared_ptr<indexlib::util::Metric> _decisionMetric;
+
+private:
+    BS_LOG_DECLARE();
+};
+
+BS_TYPEDEF_PTR(AdaptiveBuildController);
+
+} // namespace build_service::builder
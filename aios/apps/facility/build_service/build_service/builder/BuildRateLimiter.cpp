@@ -0,0 +1,60 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "build_service/builder/BuildRateLimiter.h"
+
+#include <algorithm>
+#include <unistd.h>
+
+#include "autil/TimeUtility.h"
+
+using namespace std;
+using namespace autil;
+
+namespace build_service::builder {
+BS_LOG_SETUP(builder, BuildRateLimiter);
+
+BuildRateLimiter::BuildRateLimiter() : _rate(0), _acquiredDocCount(0), _throttledTimeUs(0), _nextFreeTime(0) {}
+
+BuildRateLimiter::~BuildRateLimiter() {}
+
+void BuildRateLimiter::setRate(double docsPerSecond) { _rate.store(max(docsPerSecond, 0.0), memory_order_relaxed); }
+
+void BuildRateLimiter::acquire(size_t docCount)
+{
+    _acquiredDocCount.fetch_add(docCount, memory_order_relaxed);
+    double rate = getRate();
+    int64_t now = TimeUtility::currentTime();
+    int64_t startTime = now;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (rate <= 0) {
+            _nextFreeTime = now;
+            return;
+        }
+        // credit at most MAX_BURST_US of idle time, the batch pays for its own docs with the next batch
+        startTime = max(_nextFreeTime, now - MAX_BURST_US);
+        _nextFreeTime = startTime + (int64_t)(docCount * 1000000.0 / rate);
+    }
+    // sleep in slices to give up waiting as soon as the limiter is disabled
+    while (now < startTime && getRate() > 0) {
+        int64_t sleepUs = min(startTime - now, MAX_SLEEP_SLICE_US);
+        usleep(sleepUs);
+        _throttledTimeUs.fetch_add(sleepUs, memory_order_relaxed);
+        now = TimeUtility::currentTime();
+    }
+}
+
+} // namespace build_service::builder
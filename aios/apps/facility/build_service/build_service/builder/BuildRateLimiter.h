@@ -0,0 +1,66 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+
+#include "build_service/common_define.h"
+#include "build_service/util/Log.h"
+
+namespace build_service::builder {
+
+// docs-per-second limiter of BuilderV2 whose rate may be changed at any time
+// by a controller. unlike BuildSpeedLimiter it paces batches by delaying each
+// one by the cost of the docs built before it, so a batch never has to wait
+// for a whole second window.
+class BuildRateLimiter
+{
+public:
+    BuildRateLimiter();
+    ~BuildRateLimiter();
+
+    BuildRateLimiter(const BuildRateLimiter&) = delete;
+    BuildRateLimiter& operator=(const BuildRateLimiter&) = delete;
+
+public:
+    // docsPerSecond <= 0 means unlimited
+    void setRate(double docsPerSecond);
+    double getRate() const { return _rate.load(std::memory_order_relaxed); }
+    // block until docCount docs may be built
+    void acquire(size_t docCount);
+
+    int64_t getAcquiredDocCount() const { return _acquiredDocCount.load(std::memory_order_relaxed); }
+    int64_t getThrottledTimeUs() const { return _throttledTimeUs.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr int64_t MAX_BURST_US = 100 * 1000;
+    static constexpr int64_t MAX_SLEEP_SLICE_US = 50 * 1000;
+
+    std::atomic<double> _rate;
+    std::atomic<int64_t> _acquiredDocCount;
+    std::atomic<int64_t> _throttledTimeUs;
+    std::mutex _mutex;
+    int64_t _nextFreeTime;
+
+private:
+    BS_LOG_DECLARE();
+};
+
+BS_TYPEDEF_PTR(BuildRateLimiter);
+
+} // namespace build_service::builder
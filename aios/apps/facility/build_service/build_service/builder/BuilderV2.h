@@ -20,6 +20,7 @@
 #include <mutex>
 #include <optional>
 
+#include "build_service/builder/BuildRateLimiter.h"
 #include "build_service/config/BuilderConfig.h"
 #include "build_service/proto/ErrorCollector.h"
 #include "build_service/util/Log.h"
@@ -66,9 +67,13 @@ public:
 
 public:
     const proto::BuildId& getBuildId() const;
+    // consumers of the builder acquire docs from the limiter before build, set by realtime build control
+    void setBuildRateLimiter(const BuildRateLimiterPtr& limiter) { std::atomic_store(&_buildRateLimiter, limiter); }
+    BuildRateLimiterPtr getBuildRateLimiter() const { return std::atomic_load(&_buildRateLimiter); }
 
 protected:
     proto::BuildId _buildId;
+    BuildRateLimiterPtr _buildRateLimiter;
 };
 
 } // namespace build_service::builder
@@ -53,6 +53,7 @@ void KKVSortDocSorter::sort(std::vector<uint32_t>& sortDocVec)
     for (size_t i = 0; i < _unsortVector->size(); i++) {
         sortDocVec.push_back((*_unsortVector)[i]);
     }
+    _unsortedHeadCount = _unsortVector->size();
 
     for (size_t i = 0; i < _mergePosVector->size(); i++) {
         if ((*_mergePosVector)[i].size() == 0) {
@@ -34,6 +34,7 @@ void KVSortDocSorter::sort(std::vector<uint32_t>& sortDocVec)
     for (size_t i = 0; i < _unsortVector->size(); i++) {
         sortDocVec.push_back((*_unsortVector)[i]);
     }
+    _unsortedHeadCount = _unsortVector->size();
 
     vector<uint32_t> idxVec;
     idxVec.reserve(_mergePosVector->size());
@@ -80,6 +80,7 @@ void NormalSortDocSorter::sort(std::vector<uint32_t>& sortDocVec)
     }
     std::sort(sortDocVec.begin(), sortDocVec.end(), DocumentComparatorWrapper1(_documentVec));
     sortDocVec.insert(sortDocVec.end(), nonSortDocVec.begin(), nonSortDocVec.end());
+    _unsortedTailCount = nonSortDocVec.size();
 }
 
 }} // namespace build_service::builder
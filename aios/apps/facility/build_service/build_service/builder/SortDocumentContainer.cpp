@@ -71,6 +71,8 @@ SortDocumentContainer::SortDocumentContainer()
     , _hasInvertedIndexUpdate(false)
     , _processCursor(0)
     , _sortQueueMemUse(0)
+    , _unsortedHeadCount(0)
+    , _unsortedTailCount(0)
 {
     _documentVec.reserve(RESERVED_QUEUE_SIZE);
     _orderVec.reserve(RESERVED_QUEUE_SIZE);
@@ -118,7 +120,7 @@ bool SortDocumentContainer::init(const indexlibv2::config::SortDescriptions& sor
 
 void SortDocumentContainer::sortDocument()
 {
-    if (empty()) {
+    if (empty() || sortedDocCount() > 0) {
         return;
     }
     if (!_hasPrimaryKey) {
@@ -129,6 +131,8 @@ void SortDocumentContainer::sortDocument()
         return;
     }
     _sortDocumentSorter->sort(_orderVec);
+    _unsortedHeadCount = _sortDocumentSorter->getUnsortedHeadCount();
+    _unsortedTailCount = _sortDocumentSorter->getUnsortedTailCount();
     resetSortResource();
 }
 
@@ -138,6 +142,8 @@ void SortDocumentContainer::clear()
     _sortQueueMemUse = 0;
     _documentVec.clear();
     _orderVec.clear();
+    _unsortedHeadCount = 0;
+    _unsortedTailCount = 0;
     _converter->clear();
     _firstLocator = _lastLocator;
 }
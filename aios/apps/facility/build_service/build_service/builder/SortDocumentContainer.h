@@ -73,6 +73,8 @@ public:
         std::swap(_sortQueueMemUse, other._sortQueueMemUse);
         std::swap(_documentVec, other._documentVec);
         std::swap(_orderVec, other._orderVec);
+        std::swap(_unsortedHeadCount, other._unsortedHeadCount);
+        std::swap(_unsortedTailCount, other._unsortedTailCount);
         _converter.swap(other._converter);
         std::swap(_firstLocator, other._firstLocator);
         std::swap(_lastLocator, other._lastLocator);
@@ -98,6 +100,24 @@ public:
         assert(_processCursor <= _orderVec.size());
     }
     inline size_t getUnprocessedCount() const { return _orderVec.size() - _processCursor; }
+    inline indexlib::TableType getTableType() const { return _tableType; }
+    inline bool hasPrimaryKey() const { return _hasPrimaryKey; }
+    inline const common::Locator& getFirstLocator() const { return _firstLocator; }
+    inline const common::Locator& getLastLocator() const { return _lastLocator; }
+    inline const SortDocument& getSortedDocument(size_t idx) const
+    {
+        assert(idx < sortedDocCount());
+        return _documentVec[_orderVec[idx]];
+    }
+    // sorted docs fall into sections: 0 for the unsorted head, 1 for docs ordered by
+    // sort key and 2 for the unsorted tail, see SortDocumentSorter
+    inline uint8_t getSortedSection(size_t idx) const
+    {
+        if (idx < _unsortedHeadCount) {
+            return 0;
+        }
+        return idx + _unsortedTailCount < _orderVec.size() ? 1 : 2;
+    }
 
 private:
     void updateLocator(const autil::StringView& locatorStr);
@@ -114,6 +134,8 @@ private:
     size_t _sortQueueMemUse;
     DocumentVector _documentVec;
     std::vector<uint32_t> _orderVec;
+    size_t _unsortedHeadCount;
+    size_t _unsortedTailCount;
     SortDocumentConverterPtr _converter;
     common::Locator _firstLocator;
     common::Locator _lastLocator;
@@ -0,0 +1,491 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "build_service/builder/SortDocumentRunMerger.h"
+
+#include <atomic>
+#include <errno.h>
+#include <queue>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "autil/DataBuffer.h"
+#include "autil/HashAlgorithm.h"
+#include "autil/StringUtil.h"
+#include "fslib/fslib.h"
+
+using namespace std;
+using namespace autil;
+using namespace fslib;
+using namespace fslib::fs;
+using namespace indexlib::document;
+
+namespace build_service { namespace builder {
+BS_LOG_SETUP(builder, SortDocumentRunMerger);
+
+namespace {
+// run record: [section:uint8][docType:uint8][sortKeyLen:uint32][sortKey][docLen:uint32][docStr]
+const size_t RECORD_HEADER_SIZE = sizeof(uint8_t) * 2 + sizeof(uint32_t);
+const size_t RUN_BUFFER_SIZE = 1024 * 1024;
+// run file name: sort_run_[pid]_[seq]
+const string RUN_FILE_PREFIX = "sort_run_";
+std::atomic<uint64_t> gRunFileSeq(0);
+
+void appendRecord(string& buffer, uint8_t section, const SortDocument& sortDoc, const StringView& sortKey,
+                  const StringView& docStr)
+{
+    uint8_t docType = (uint8_t)sortDoc._docType;
+    uint32_t sortKeyLen = sortKey.size();
+    uint32_t docLen = docStr.size();
+    buffer.append((const char*)&section, sizeof(section));
+    buffer.append((const char*)&docType, sizeof(docType));
+    buffer.append((const char*)&sortKeyLen, sizeof(sortKeyLen));
+    buffer.append(sortKey.data(), sortKeyLen);
+    buffer.append((const char*)&docLen, sizeof(docLen));
+    buffer.append(docStr.data(), docLen);
+}
+
+bool flushBuffer(File* file, string& buffer)
+{
+    if (buffer.empty()) {
+        return true;
+    }
+    ssize_t writeLen = file->write(buffer.data(), buffer.size());
+    if (writeLen != (ssize_t)buffer.size()) {
+        return false;
+    }
+    buffer.clear();
+    return true;
+}
+} // namespace
+
+class SortDocumentRunMerger::RunReader
+{
+public:
+    RunReader() : _offset(0), _dataBegin(0), _dataEnd(0) {}
+
+public:
+    bool open(const string& fileName)
+    {
+        _fileName = fileName;
+        _file.reset(FileSystem::openFile(fileName, READ));
+        if (!_file || !_file->isOpened()) {
+            BS_LOG(ERROR, "open sort run file [%s] failed", fileName.c_str());
+            return false;
+        }
+        _buffer.resize(RUN_BUFFER_SIZE);
+        return true;
+    }
+    // views in sortDoc point to the read buffer and are valid until the next call
+    bool next(uint8_t& section, SortDocument& sortDoc, bool& eof)
+    {
+        eof = false;
+        if (!fill(RECORD_HEADER_SIZE)) {
+            return false;
+        }
+        if (_dataBegin == _dataEnd) {
+            eof = true;
+            return true;
+        }
+        uint32_t sortKeyLen = 0;
+        if (_dataEnd - _dataBegin < RECORD_HEADER_SIZE) {
+            return truncated();
+        }
+        memcpy(&sortKeyLen, _buffer.data() + _dataBegin + sizeof(uint8_t) * 2, sizeof(sortKeyLen));
+        size_t docLenEnd = RECORD_HEADER_SIZE + sortKeyLen + sizeof(uint32_t);
+        if (!fill(docLenEnd)) {
+            return false;
+        }
+        if (_dataEnd - _dataBegin < docLenEnd) {
+            return truncated();
+        }
+        uint32_t docLen = 0;
+        memcpy(&docLen, _buffer.data() + _dataBegin + docLenEnd - sizeof(uint32_t), sizeof(docLen));
+        size_t recordLen = docLenEnd + docLen;
+        if (!fill(recordLen)) {
+            return false;
+        }
+        if (_dataEnd - _dataBegin < recordLen) {
+            return truncated();
+        }
+        const char* record = _buffer.data() + _dataBegin;
+        section = (uint8_t)record[0];
+        sortDoc._docType = (DocOperateType)(uint8_t)record[1];
+        sortDoc._sortKey = StringView(record + RECORD_HEADER_SIZE, sortKeyLen);
+        sortDoc._docStr = StringView(record + docLenEnd, docLen);
+        _dataBegin += recordLen;
+        return true;
+    }
+
+private:
+    bool fill(size_t len)
+    {
+        if (_dataEnd - _dataBegin >= len) {
+            return true;
+        }
+        if (_dataBegin > 0) {
+            memmove(_buffer.data(), _buffer.data() + _dataBegin, _dataEnd - _dataBegin);
+            _dataEnd -= _dataBegin;
+            _dataBegin = 0;
+        }
+        if (_buffer.size() < len) {
+            _buffer.resize(len);
+        }
+        while (_dataEnd < len) {
+            ssize_t readLen = _file->pread(_buffer.data() + _dataEnd, _buffer.size() - _dataEnd, _offset);
+            if (readLen < 0) {
+                BS_LOG(ERROR, "read sort run file [%s] failed: %s", _fileName.c_str(),
+                       FileSystem::getErrorString(_file->getLastError()).c_str());
+                return false;
+            }
+            if (readLen == 0) {
+                break;
+            }
+            _dataEnd += readLen;
+            _offset += readLen;
+        }
+        return true;
+    }
+    bool truncated()
+    {
+        BS_LOG(ERROR, "sort run file [%s] truncated at offset [%ld]", _fileName.c_str(),
+               _offset - (int64_t)(_dataEnd - _dataBegin));
+        return false;
+    }
+
+private:
+    string _fileName;
+    FilePtr _file;
+    int64_t _offset;
+    vector<char> _buffer;
+    size_t _dataBegin;
+    size_t _dataEnd;
+};
+
+struct SortDocumentRunMerger::RunCursor {
+    uint32_t runIdx;
+    uint8_t section;
+    SortDocument sortDoc;
+    size_t memIdx;
+};
+
+struct SortDocumentRunMerger::RunCursorComparator {
+    // priority_queue pops the greatest, so the cursor that builds later is the lesser one
+    bool operator()(const RunCursor* left, const RunCursor* right) const
+    {
+        if (left->section != right->section) {
+            return left->section > right->section;
+        }
+        if (left->section == 1) {
+            const StringView& leftKey = left->sortDoc._sortKey;
+            const StringView& rightKey = right->sortDoc._sortKey;
+            int r = memcmp(leftKey.data(), rightKey.data(), min(leftKey.size(), rightKey.size()));
+            if (r != 0) {
+                return r > 0;
+            }
+            if (leftKey.size() != rightKey.size()) {
+                return leftKey.size() > rightKey.size();
+            }
+        }
+        return left->runIdx > right->runIdx;
+    }
+};
+
+SortDocumentRunMerger::SortDocumentRunMerger()
+    : _tableType(indexlib::tt_index)
+    , _runDocCount(0)
+    , _spilledBytes(0)
+{
+}
+
+SortDocumentRunMerger::~SortDocumentRunMerger() { clear(); }
+
+bool SortDocumentRunMerger::init(const string& runDir)
+{
+    _runDir = runDir;
+    if (FileSystem::isExist(_runDir) == EC_TRUE) {
+        removeStaleRuns();
+        return true;
+    }
+    ErrorCode ec = FileSystem::mkDir(_runDir, true);
+    if (ec != EC_OK && ec != EC_EXIST) {
+        BS_LOG(ERROR, "create sort run dir [%s] failed: %s", _runDir.c_str(), FileSystem::getErrorString(ec).c_str());
+        return false;
+    }
+    return true;
+}
+
+void SortDocumentRunMerger::removeStaleRuns() const
+{
+    // runs of a crashed process are never merged or cleared, remove those whose process is gone.
+    // the dir may be shared, runs of live processes are left alone
+    FileList fileList;
+    ErrorCode ec = FileSystem::listDir(_runDir, fileList);
+    if (ec != EC_OK) {
+        BS_LOG(WARN, "list sort run dir [%s] failed: %s", _runDir.c_str(), FileSystem::getErrorString(ec).c_str());
+        return;
+    }
+    for (const auto& fileName : fileList) {
+        if (fileName.compare(0, RUN_FILE_PREFIX.size(), RUN_FILE_PREFIX) != 0) {
+            continue;
+        }
+        vector<string> items = StringUtil::split(fileName.substr(RUN_FILE_PREFIX.size()), "_");
+        pid_t pid = 0;
+        if (items.size() != 2 || !StringUtil::fromString(items[0], pid) || pid <= 0 || pid == getpid()) {
+            continue;
+        }
+        if (kill(pid, 0) == 0 || errno != ESRCH) {
+            continue;
+        }
+        string filePath = _runDir + "/" + fileName;
+        ec = FileSystem::remove(filePath);
+        if (ec != EC_OK && ec != EC_NOENT) {
+            BS_LOG(WARN, "remove stale sort run file [%s] failed: %s", filePath.c_str(),
+                   FileSystem::getErrorString(ec).c_str());
+            continue;
+        }
+        BS_LOG(INFO, "removed stale sort run file [%s] of exited process [%d]", filePath.c_str(), pid);
+    }
+}
+
+uint64_t SortDocumentRunMerger::getPkHash(const SortDocument& sortDoc)
+{
+    if (sortDoc._kvDoc) {
+        return sortDoc._kvDoc->back().GetPKeyHash();
+    }
+    return HashAlgorithm::hashString64(sortDoc._pk.data(), sortDoc._pk.size());
+}
+
+void SortDocumentRunMerger::getMergeSortKeys(const SortDocumentContainer& container, vector<StringView>& sortKeys)
+{
+    size_t docCount = container.sortedDocCount();
+    sortKeys.resize(docCount);
+    for (size_t i = 0; i < docCount; ++i) {
+        sortKeys[i] = container.getSortedDocument(i)._sortKey;
+    }
+    if (container.getTableType() != indexlib::tt_kv) {
+        return;
+    }
+    // kv docs of one pk are ordered by the key of the last doc of the group, see KVSortDocSorter,
+    // all of them carry that key so the group stays together and in place when runs are merged
+    size_t groupEnd = docCount;
+    for (size_t i = docCount; i > 0; --i) {
+        size_t idx = i - 1;
+        if (container.getSortedSection(idx) != 1) {
+            groupEnd = idx;
+            continue;
+        }
+        if (groupEnd < docCount && container.getSortedSection(groupEnd) == 1 &&
+            container.getSortedDocument(idx)._pk == container.getSortedDocument(groupEnd)._pk) {
+            sortKeys[idx] = sortKeys[groupEnd];
+        } else {
+            groupEnd = idx;
+        }
+    }
+}
+
+bool SortDocumentRunMerger::hasConflictPk(const SortDocumentContainer& container) const
+{
+    if (_spilledPks.empty()) {
+        return false;
+    }
+    for (size_t i = 0; i < container.sortedDocCount(); ++i) {
+        if (_spilledPks.find(getPkHash(container.getSortedDocument(i))) != _spilledPks.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SortDocumentRunMerger::spill(const SortDocumentContainer& container)
+{
+    size_t docCount = container.sortedDocCount();
+    if (docCount == 0) {
+        return true;
+    }
+    string fileName =
+        _runDir + "/" + RUN_FILE_PREFIX + StringUtil::toString(getpid()) + "_" + StringUtil::toString(gRunFileSeq++);
+    FilePtr file(FileSystem::openFile(fileName, WRITE));
+    if (!file || !file->isOpened()) {
+        BS_LOG(ERROR, "open sort run file [%s] for write failed", fileName.c_str());
+        return false;
+    }
+
+    bool hasPrimaryKey = container.hasPrimaryKey();
+    vector<StringView> sortKeys;
+    getMergeSortKeys(container, sortKeys);
+    vector<uint64_t> pkHashs;
+    pkHashs.reserve(hasPrimaryKey ? docCount : 0);
+    string buffer;
+    buffer.reserve(RUN_BUFFER_SIZE);
+    DataBuffer dataBuffer;
+    size_t fileLength = 0;
+    bool ret = true;
+    for (size_t i = 0; i < docCount; ++i) {
+        const SortDocument& sortDoc = container.getSortedDocument(i);
+        StringView docStr = sortDoc._docStr;
+        if (docStr.empty() && sortDoc._kvDoc) {
+            dataBuffer.clear();
+            dataBuffer.write(sortDoc._kvDoc);
+            docStr = StringView(dataBuffer.getData(), dataBuffer.getDataLen());
+        }
+        appendRecord(buffer, container.getSortedSection(i), sortDoc, sortKeys[i], docStr);
+        if (hasPrimaryKey) {
+            pkHashs.push_back(getPkHash(sortDoc));
+        }
+        if (buffer.size() >= RUN_BUFFER_SIZE) {
+            fileLength += buffer.size();
+            if (!flushBuffer(file.get(), buffer)) {
+                ret = false;
+                break;
+            }
+        }
+    }
+    fileLength += buffer.size();
+    ret = ret && flushBuffer(file.get(), buffer);
+    ret = (file->close() == EC_OK) && ret;
+    if (!ret) {
+        BS_LOG(ERROR, "write sort run file [%s] failed", fileName.c_str());
+        FileSystem::remove(fileName);
+        return false;
+    }
+
+    if (_runFiles.empty()) {
+        _firstLocator = container.getFirstLocator();
+        _tableType = container.getTableType();
+    }
+    _lastLocator = container.getLastLocator();
+    _runFiles.push_back(fileName);
+    _spilledPks.insert(pkHashs.begin(), pkHashs.end());
+    _runDocCount += docCount;
+    _spilledBytes += fileLength;
+    BS_LOG(INFO, "spill sort run [%s], docCount [%lu], size [%lu], total runs [%lu], total size [%lu]",
+           fileName.c_str(), docCount, fileLength, _runFiles.size(), _spilledBytes);
+    return true;
+}
+
+DocumentPtr SortDocumentRunMerger::decodeDocument(const SortDocument& sortDoc) const
+{
+    DocumentPtr doc;
+    if (_tableType == indexlib::tt_kv || _tableType == indexlib::tt_kkv) {
+        doc = sortDoc.deserailize<KVDocumentPtr>();
+    } else {
+        doc = sortDoc.deserailize<NormalDocumentPtr>();
+    }
+    return doc;
+}
+
+bool SortDocumentRunMerger::merge(SortDocumentContainer& memRun, const BuildFunc& buildFunc)
+{
+    size_t runCount = _runFiles.size();
+    size_t memDocCount = memRun.sortedDocCount();
+    vector<RunReader> readers(runCount);
+    vector<RunCursor> cursors(runCount + 1);
+    priority_queue<RunCursor*, vector<RunCursor*>, RunCursorComparator> heap;
+    for (size_t i = 0; i < runCount; ++i) {
+        bool eof = false;
+        cursors[i].runIdx = i;
+        if (!readers[i].open(_runFiles[i]) || !readers[i].next(cursors[i].section, cursors[i].sortDoc, eof)) {
+            return false;
+        }
+        if (!eof) {
+            heap.push(&cursors[i]);
+        }
+    }
+    vector<StringView> memSortKeys;
+    getMergeSortKeys(memRun, memSortKeys);
+    RunCursor& memCursor = cursors[runCount];
+    memCursor.runIdx = runCount;
+    memCursor.memIdx = 0;
+    if (memDocCount > 0) {
+        memCursor.section = memRun.getSortedSection(0);
+        memCursor.sortDoc = memRun.getSortedDocument(0);
+        memCursor.sortDoc._sortKey = memSortKeys[0];
+        heap.push(&memCursor);
+    }
+
+    size_t totalDocCount = _runDocCount + memDocCount;
+    size_t builtDocCount = 0;
+    const common::Locator& lastLocator = memRun.empty() ? _lastLocator : memRun.getLastLocator();
+    string firstLocatorStr = _firstLocator.Serialize();
+    while (!heap.empty()) {
+        RunCursor* cursor = heap.top();
+        heap.pop();
+        DocumentPtr doc;
+        if (cursor == &memCursor) {
+            memRun.incProcessCursor();
+            doc = memRun[cursor->memIdx];
+        } else {
+            doc = decodeDocument(cursor->sortDoc);
+        }
+        if (!doc) {
+            BS_LOG(ERROR, "decode document of sort run [%u] failed", cursor->runIdx);
+            return false;
+        }
+        ++builtDocCount;
+        doc->SetLocator(builtDocCount == totalDocCount ? lastLocator.Serialize() : firstLocatorStr);
+        if (!buildFunc(doc)) {
+            return false;
+        }
+
+        if (cursor == &memCursor) {
+            if (++cursor->memIdx < memDocCount) {
+                cursor->section = memRun.getSortedSection(cursor->memIdx);
+                cursor->sortDoc = memRun.getSortedDocument(cursor->memIdx);
+                cursor->sortDoc._sortKey = memSortKeys[cursor->memIdx];
+                heap.push(cursor);
+            }
+            continue;
+        }
+        bool eof = false;
+        if (!readers[cursor->runIdx].next(cursor->section, cursor->sortDoc, eof)) {
+            return false;
+        }
+        if (!eof) {
+            heap.push(cursor);
+        }
+    }
+    return true;
+}
+
+void SortDocumentRunMerger::clear()
+{
+    for (const auto& fileName : _runFiles) {
+        ErrorCode ec = FileSystem::remove(fileName);
+        if (ec != EC_OK) {
+            BS_LOG(WARN, "remove sort run file [%s] failed: %s", fileName.c_str(),
+                   FileSystem::getErrorString(ec).c_str());
+        }
+    }
+    _runFiles.clear();
+    _spilledPks.clear();
+    _runDocCount = 0;
+    _spilledBytes = 0;
+}
+
+void SortDocumentRunMerger::swap(SortDocumentRunMerger& other)
+{
+    std::swap(_runDir, other._runDir);
+    std::swap(_tableType, other._tableType);
+    std::swap(_runFiles, other._runFiles);
+    std::swap(_spilledPks, other._spilledPks);
+    std::swap(_firstLocator, other._firstLocator);
+    std::swap(_lastLocator, other._lastLocator);
+    std::swap(_runDocCount, other._runDocCount);
+    std::swap(_spilledBytes, other._spilledBytes);
+}
+
+}} // namespace build_service::builder
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ISEARCH_BS_SORTDOCUMENTRUNMERGER_H
+#define ISEARCH_BS_SORTDOCUMENTRUNMERGER_H
+
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "build_service/builder/SortDocumentContainer.h"
+#include "build_service/common/Locator.h"
+#include "build_service/common_define.h"
+#include "build_service/util/Log.h"
+
+namespace build_service { namespace builder {
+
+// Spills sorted containers to local run files and merges them with the last
+// in-memory container, so several sort batches end up in one sorted segment
+// while only one batch is held in memory. A primary key must not be spread
+// over several runs, check hasConflictPk before spilling.
+class SortDocumentRunMerger
+{
+public:
+    typedef std::function<bool(const indexlib::document::DocumentPtr&)> BuildFunc;
+
+public:
+    SortDocumentRunMerger();
+    ~SortDocumentRunMerger();
+
+private:
+    SortDocumentRunMerger(const SortDocumentRunMerger&);
+    SortDocumentRunMerger& operator=(const SortDocumentRunMerger&);
+
+public:
+    bool init(const std::string& runDir);
+    // container must be sorted
+    bool spill(const SortDocumentContainer& container);
+    bool hasConflictPk(const SortDocumentContainer& container) const;
+    // calls buildFunc on docs of all runs and the sorted docs of memRun in merged order
+    bool merge(SortDocumentContainer& memRun, const BuildFunc& buildFunc);
+    void clear();
+    void swap(SortDocumentRunMerger& other);
+    bool empty() const { return _runFiles.empty(); }
+    size_t getRunCount() const { return _runFiles.size(); }
+    size_t getRunDocCount() const { return _runDocCount; }
+    size_t getSpilledBytes() const { return _spilledBytes; }
+
+private:
+    class RunReader;
+    struct RunCursor;
+    struct RunCursorComparator;
+
+private:
+    static uint64_t getPkHash(const SortDocument& sortDoc);
+    // sort keys the runs are merged by, indexed by sorted position
+    static void getMergeSortKeys(const SortDocumentContainer& container, std::vector<autil::StringView>& sortKeys);
+    void removeStaleRuns() const;
+    indexlib::document::DocumentPtr decodeDocument(const SortDocument& sortDoc) const;
+
+private:
+    std::string _runDir;
+    indexlib::TableType _tableType;
+    std::vector<std::string> _runFiles;
+    std::unordered_set<uint64_t> _spilledPks;
+    common::Locator _firstLocator;
+    common::Locator _lastLocator;
+    size_t _runDocCount;
+    size_t _spilledBytes;
+
+private:
+    BS_LOG_DECLARE();
+};
+
+BS_TYPEDEF_PTR(SortDocumentRunMerger);
+
+}} // namespace build_service::builder
+
+#endif // ISEARCH_BS_SORTDOCUMENTRUNMERGER_H
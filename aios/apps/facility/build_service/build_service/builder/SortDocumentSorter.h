@@ -36,9 +36,14 @@ public:
     virtual void push(const SortDocument& sortDoc, uint32_t pos) = 0;
     virtual void sort(std::vector<uint32_t>& sortDocVec) = 0;
     size_t getMemUse() const { return _pool->getUsedBytes(); }
+    // layout of the last sort result: [unsorted head][ordered by sort key][unsorted tail]
+    size_t getUnsortedHeadCount() const { return _unsortedHeadCount; }
+    size_t getUnsortedTailCount() const { return _unsortedTailCount; }
 
 protected:
     std::shared_ptr<autil::mem_pool::Pool> _pool;
+    size_t _unsortedHeadCount = 0;
+    size_t _unsortedTailCount = 0;
 
 private:
     BS_LOG_DECLARE();
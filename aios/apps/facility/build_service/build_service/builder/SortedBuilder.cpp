@@ -44,6 +44,7 @@ SortedBuilder::SortedBuilder(const IndexBuilderPtr& indexBuilder, size_t buildTo
     , _buildTotalMem(buildTotalMemMB)
     , _sortQueueMem(-1)
     , _sortQueueSize(0)
+    , _externalSortRunCount(1)
 {
 }
 
@@ -74,6 +75,10 @@ bool SortedBuilder::init(const BuilderConfig& builderConfig, indexlib::util::Met
     if (!initSortContainers(builderConfig, schema)) {
         return false;
     }
+    if (_externalSortRunCount > 1 &&
+        (!_collectRuns.init(builderConfig.externalSortTempDir) || !_buildRuns.init(builderConfig.externalSortTempDir))) {
+        return false;
+    }
 
     _sortQueueSizeMetric = DECLARE_METRIC(metricProvider, "perf/sortQueueSize", kmonitor::STATUS, "count");
     _buildQueueSizeMetric = DECLARE_METRIC(metricProvider, "perf/buildQueueSize", kmonitor::STATUS, "count");
@@ -103,7 +108,9 @@ void SortedBuilder::initConfig(const BuilderConfig& builderConfig)
 {
     _sortQueueMem = calculateSortQueueMemory(builderConfig, _buildTotalMem);
     _sortQueueSize = builderConfig.sortQueueSize;
-    BS_PREFIX_LOG(INFO, "sortQueueMem [%ld MB], sortQueueSize [%u]", _sortQueueMem, _sortQueueSize);
+    _externalSortRunCount = builderConfig.externalSortRunCount;
+    BS_PREFIX_LOG(INFO, "sortQueueMem [%ld MB], sortQueueSize [%u], externalSortRunCount [%u]", _sortQueueMem,
+                  _sortQueueSize, _externalSortRunCount);
 }
 
 bool SortedBuilder::initSortContainers(const BuilderConfig& builderConfig, const IndexPartitionSchemaPtr& schema)
@@ -149,7 +156,9 @@ bool SortedBuilder::build(const DocumentPtr& doc)
                                           "SortedBuilder need auto flush sortQueue :"
                                           "sortQueueMemory[%lu] quota[%lu], queueDocCount[%lu] queueSize[%u].",
                                           sortQueueMem, _sortQueueMem, _collectContainer.allDocCount(), _sortQueueSize);
-        flushUnsafe();
+        if (!spillUnsafe()) {
+            flushUnsafe();
+        }
     }
     return true;
 }
@@ -191,6 +200,9 @@ void SortedBuilder::flush()
 void SortedBuilder::flushUnsafe()
 {
     if (_collectContainer.empty()) {
+        if (!_collectRuns.empty()) {
+            handOverRunsUnsafe();
+        }
         return;
     }
 
@@ -204,25 +216,66 @@ void SortedBuilder::flushUnsafe()
                                       "docCount [%ld] memoryUse [%ld]",
                                       endSortTs - beginSortTs, _collectContainer.allDocCount(),
                                       _collectContainer.memUse());
+    if (_collectRuns.hasConflictPk(_collectContainer)) {
+        // a pk must not span the spilled runs and the memory run, build spilled runs into a segment first
+        handOverRunsUnsafe();
+    }
 
     ScopedLock lock(_swapCond);
-    while (!_buildContainer.empty()) {
+    while (!_buildContainer.empty() || !_buildRuns.empty()) {
         _swapCond.producerWait();
     }
     _buildContainer.swap(_collectContainer);
+    _buildRuns.swap(_collectRuns);
     REPORT_METRIC(_sortQueueSizeMetric, _collectContainer.allDocCount());
     REPORT_METRIC(_buildQueueSizeMetric, _buildContainer.getUnprocessedCount());
     REPORT_METRIC(_sortQueueMemUseMetric, _collectContainer.memUse());
     _swapCond.signalConsumer();
 }
 
+bool SortedBuilder::spillUnsafe()
+{
+    if (_externalSortRunCount <= 1 || _collectRuns.getRunCount() + 1 >= _externalSortRunCount) {
+        return false;
+    }
+    REPORT_METRIC(_sortThreadStatusMetric, Sorting);
+    _collectContainer.sortDocument();
+    REPORT_METRIC(_sortThreadStatusMetric, Pushing);
+    if (_collectRuns.hasConflictPk(_collectContainer)) {
+        handOverRunsUnsafe();
+    }
+    if (!_collectRuns.spill(_collectContainer)) {
+        BS_PREFIX_LOG(WARN, "spill sort run failed, build collected docs from memory");
+        return false;
+    }
+    BEEPER_FORMAT_REPORT_WITHOUT_TAGS(INDEXLIB_BUILD_INFO_COLLECTOR_NAME,
+                                      "SortedBuilder spill sort run: runCount [%lu], runDocCount [%lu], "
+                                      "spilledBytes [%lu]",
+                                      _collectRuns.getRunCount(), _collectRuns.getRunDocCount(),
+                                      _collectRuns.getSpilledBytes());
+    _collectContainer.clear();
+    REPORT_METRIC(_sortQueueSizeMetric, _collectContainer.allDocCount());
+    REPORT_METRIC(_sortQueueMemUseMetric, _collectContainer.memUse());
+    return true;
+}
+
+void SortedBuilder::handOverRunsUnsafe()
+{
+    ScopedLock lock(_swapCond);
+    while (!_buildContainer.empty() || !_buildRuns.empty()) {
+        _swapCond.producerWait();
+    }
+    _buildRuns.swap(_collectRuns);
+    _swapCond.signalConsumer();
+}
+
 void SortedBuilder::buildThread()
 {
     while (_running) {
         {
             REPORT_METRIC(_buildThreadStatusMetric, WaitingSortDone);
             ScopedLock lock(_swapCond);
-            while (_buildContainer.empty() && _running) {
+            while (_buildContainer.empty() && _buildRuns.empty() && _running) {
                 _swapCond.consumerWait(10 * 1000);
             }
 
@@ -231,6 +284,7 @@ void SortedBuilder::buildThread()
             REPORT_METRIC(_buildThreadStatusMetric, WaitingSortDone);
 
             _buildContainer.clear();
+            _buildRuns.clear();
             _swapCond.signalProducer();
         }
         if (hasFatalError()) {
@@ -246,17 +300,30 @@ void SortedBuilder::buildThread()
 void SortedBuilder::buildAll()
 {
     int64_t beginBuildTs = TimeUtility::currentTimeInSeconds();
-    for (size_t i = 0; i < _buildContainer.sortedDocCount(); ++i) {
-        _buildContainer.incProcessCursor();
-        REPORT_METRIC(_buildQueueSizeMetric, _buildContainer.getUnprocessedCount());
-        if (!buildOneDoc(_buildContainer[i])) {
-            break;
+    if (_buildRuns.empty()) {
+        for (size_t i = 0; i < _buildContainer.sortedDocCount(); ++i) {
+            _buildContainer.incProcessCursor();
+            REPORT_METRIC(_buildQueueSizeMetric, _buildContainer.getUnprocessedCount());
+            if (!buildOneDoc(_buildContainer[i])) {
+                break;
+            }
+        }
+    } else {
+        auto buildFunc = [this](const DocumentPtr& doc) {
+            REPORT_METRIC(_buildQueueSizeMetric, _buildContainer.getUnprocessedCount());
+            return buildOneDoc(doc);
+        };
+        if (!_buildRuns.merge(_buildContainer, buildFunc) && !hasFatalError()) {
+            BS_PREFIX_LOG(ERROR, "merge [%lu] sort runs failed", _buildRuns.getRunCount());
+            setFatalError();
         }
     }
     int64_t endBuildTs = TimeUtility::currentTimeInSeconds();
     BEEPER_FORMAT_REPORT_WITHOUT_TAGS(INDEXLIB_BUILD_INFO_COLLECTOR_NAME,
-                                      "SortedBuilder buildAll sortDocuments: sortedDocCount [%ld], cost [%ld] seconds.",
-                                      _buildContainer.sortedDocCount(), endBuildTs - beginBuildTs);
+                                      "SortedBuilder buildAll sortDocuments: sortedDocCount [%ld], "
+                                      "runCount [%ld], runDocCount [%ld], cost [%ld] seconds.",
+                                      _buildContainer.sortedDocCount(), _buildRuns.getRunCount(),
+                                      _buildRuns.getRunDocCount(), endBuildTs - beginBuildTs);
 }
 
 void SortedBuilder::dumpAll()
@@ -294,7 +361,7 @@ void SortedBuilder::waitAllDocBuilt()
                 break;
             }
 
-            if (_buildContainer.empty()) {
+            if (_buildContainer.empty() && _buildRuns.empty()) {
                 // TODO: legacy code for switch off async sort builder
                 if (!_asyncBuilder) {
                     break;
@@ -324,7 +391,7 @@ bool SortedBuilder::tryDump()
 {
     {
         ScopedLock lock(_swapCond);
-        if (!_buildContainer.empty()) {
+        if (!_buildContainer.empty() || !_buildRuns.empty()) {
             return false;
         }
     }
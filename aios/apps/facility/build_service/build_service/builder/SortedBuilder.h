@@ -21,6 +21,7 @@
 #include "build_service/builder/AsyncBuilder.h"
 #include "build_service/builder/Builder.h"
 #include "build_service/builder/SortDocumentContainer.h"
+#include "build_service/builder/SortDocumentRunMerger.h"
 #include "build_service/common_define.h"
 #include "build_service/config/BuilderConfig.h"
 #include "build_service/util/Log.h"
@@ -71,6 +72,8 @@ private:
 
     void flush();
     void flushUnsafe();
+    bool spillUnsafe();
+    void handOverRunsUnsafe();
     void buildAll();
     void dumpAll();
     void waitAllDocBuilt();
@@ -97,10 +100,13 @@ private:
     size_t _buildTotalMem;
     int64_t _sortQueueMem;
     uint32_t _sortQueueSize;
+    uint32_t _externalSortRunCount;
     mutable autil::ThreadMutex _collectContainerLock;
     mutable autil::ProducerConsumerCond _swapCond;
     SortDocumentContainer _collectContainer;
     SortDocumentContainer _buildContainer;
+    SortDocumentRunMerger _collectRuns;
+    SortDocumentRunMerger _buildRuns;
     AsyncBuilderPtr _asyncBuilder;
     autil::ThreadPtr _batchBuildThreadPtr;
     indexlib::util::MetricPtr _sortQueueSizeMetric;
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "build_service/config/AdaptiveBuildConfig.h"
+
+namespace build_service::config {
+
+void AdaptiveBuildConfig::Jsonize(autil::legacy::Jsonizable::JsonWrapper& json)
+{
+    json.Jsonize("enable", enable, enable);
+    json.Jsonize("query_latency_p99_slo_ms", queryLatencyP99SloMs, queryLatencyP99SloMs);
+    json.Jsonize("min_query_sample_count", minQuerySampleCount, minQuerySampleCount);
+    json.Jsonize("cpu_run_queue_slo", cpuRunQueueSlo, cpuRunQueueSlo);
+    json.Jsonize("memory_use_ratio_slo", memoryUseRatioSlo, memoryUseRatioSlo);
+    json.Jsonize("recover_ratio", recoverRatio, recoverRatio);
+    json.Jsonize("min_docs_per_second", minDocsPerSecond, minDocsPerSecond);
+    json.Jsonize("max_docs_per_second", maxDocsPerSecond, maxDocsPerSecond);
+    json.Jsonize("increase_docs_per_second", increaseDocsPerSecond, increaseDocsPerSecond);
+    json.Jsonize("decrease_ratio", decreaseRatio, decreaseRatio);
+}
+
+bool AdaptiveBuildConfig::validate() const
+{
+    if (minDocsPerSecond <= 0 || increaseDocsPerSecond <= 0) {
+        return false;
+    }
+    if (maxDocsPerSecond > 0 && maxDocsPerSecond < minDocsPerSecond) {
+        return false;
+    }
+    if (decreaseRatio <= 0 || decreaseRatio >= 1 || recoverRatio <= 0 || recoverRatio > 1) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace build_service::config
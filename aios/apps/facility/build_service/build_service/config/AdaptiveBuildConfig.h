@@ -0,0 +1,53 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "autil/legacy/jsonizable.h"
+#include "build_service/util/Log.h"
+
+namespace build_service::config {
+
+// slo targets of the adaptive realtime build controller, read from
+// build_option_config.adaptive_build_control of the cluster config.
+// a target <= 0 disables the corresponding signal.
+class AdaptiveBuildConfig : public autil::legacy::Jsonizable
+{
+public:
+    AdaptiveBuildConfig() = default;
+    ~AdaptiveBuildConfig() = default;
+
+public:
+    void Jsonize(autil::legacy::Jsonizable::JsonWrapper& json) override;
+    bool validate() const;
+
+public:
+    bool enable = false;
+    double queryLatencyP99SloMs = 0;
+    uint64_t minQuerySampleCount = 20;
+    // runnable threads per cpu core
+    double cpuRunQueueSlo = 1.5;
+    // rt index memory use / build memory quota
+    double memoryUseRatioSlo = 0.8;
+    // all signals below slo * recoverRatio let the build rate grow again
+    double recoverRatio = 0.8;
+    double minDocsPerSecond = 100;
+    // 0 means the build rate is unlimited once the signals are healthy
+    double maxDocsPerSecond = 0;
+    double increaseDocsPerSecond = 500;
+    double decreaseRatio = 0.5;
+};
+
+} // namespace build_service::config
@@ -24,6 +24,7 @@ const uint32_t BuilderConfig::DEFAULT_SORT_QUEUE_SIZE = numeric_limits<uint32_t>
 const uint32_t BuilderConfig::DEFAULT_ASYNC_QUEUE_SIZE = 10000;
 const int64_t BuilderConfig::INVALID_SORT_QUEUE_MEM = -1;
 const int64_t BuilderConfig::INVALID_ASYNC_QUEUE_MEM = -1;
+const string BuilderConfig::DEFAULT_EXTERNAL_SORT_TEMP_DIR = "./external_sort_runs";
 
 BuilderConfig::BuilderConfig()
     : sortQueueMem(INVALID_SORT_QUEUE_MEM)
@@ -38,6 +39,8 @@ BuilderConfig::BuilderConfig()
     , batchBuildSize(1)
     , consistentModeBuildThreadCount(-1)
     , inconsistentModeBuildThreadCount(-1)
+    , externalSortRunCount(1)
+    , externalSortTempDir(DEFAULT_EXTERNAL_SORT_TEMP_DIR)
 {
 }
 
@@ -59,6 +62,8 @@ void BuilderConfig::Jsonize(autil::legacy::Jsonizable::JsonWrapper& json)
     json.Jsonize("consistent_mode_build_thread_count", consistentModeBuildThreadCount, consistentModeBuildThreadCount);
     json.Jsonize("inconsistent_mode_build_thread_count", inconsistentModeBuildThreadCount,
                  inconsistentModeBuildThreadCount);
+    json.Jsonize("external_sort_run_count", externalSortRunCount, externalSortRunCount);
+    json.Jsonize("external_sort_temp_dir", externalSortTempDir, externalSortTempDir);
 }
 
 bool BuilderConfig::operator==(const BuilderConfig& other) const
@@ -69,7 +74,8 @@ bool BuilderConfig::operator==(const BuilderConfig& other) const
            asyncBuild == other.asyncBuild && asyncQueueSize == other.asyncQueueSize &&
            batchBuildSize == other.batchBuildSize &&
            consistentModeBuildThreadCount == other.consistentModeBuildThreadCount &&
-           inconsistentModeBuildThreadCount == other.inconsistentModeBuildThreadCount;
+           inconsistentModeBuildThreadCount == other.inconsistentModeBuildThreadCount &&
+           externalSortRunCount == other.externalSortRunCount && externalSortTempDir == other.externalSortTempDir;
 }
 
 bool BuilderConfig::validate() const
@@ -89,6 +95,16 @@ bool BuilderConfig::validate() const
         BS_LOG(ERROR, "%s", errorMsg.c_str());
         return false;
     }
+    if (sortBuild && externalSortRunCount > 1 && externalSortTempDir.empty()) {
+        string errorMsg = "external sort build with empty external sort temp dir";
+        BS_LOG(ERROR, "%s", errorMsg.c_str());
+        return false;
+    }
+    if (externalSortRunCount == 0) {
+        string errorMsg = "external sort run count zero";
+        BS_LOG(ERROR, "%s", errorMsg.c_str());
+        return false;
+    }
     // delay validate sort_descriptions
     return true;
 }
@@ -58,12 +58,16 @@ public:
     int32_t consistentModeBuildThreadCount;
     int32_t inconsistentModeBuildThreadCount;
     indexlibv2::config::SortDescriptions sortDescriptions;
+    // sort build spills sorted runs to local files and merges up to this many runs into one segment
+    uint32_t externalSortRunCount;
+    std::string externalSortTempDir;
 
 public:
     static const uint32_t DEFAULT_SORT_QUEUE_SIZE;
     static const uint32_t DEFAULT_ASYNC_QUEUE_SIZE;
     static const int64_t INVALID_SORT_QUEUE_MEM;
     static const int64_t INVALID_ASYNC_QUEUE_MEM;
+    static const std::string DEFAULT_EXTERNAL_SORT_TEMP_DIR;
     static constexpr double SORT_QUEUE_MEM_FACTOR = 0.3;
 
 private:
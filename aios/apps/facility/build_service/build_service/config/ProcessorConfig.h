@@ -44,6 +44,8 @@ public:
 public:
     uint32_t processorThreadNum;
     uint32_t processorQueueSize;
+    // threads parsing index documents after processors, 0 means parsing in processor threads
+    uint32_t processorParseThreadNum;
 
     uint32_t srcThreadNum;
     uint32_t srcQueueSize;
@@ -122,6 +122,14 @@ std::unique_ptr<ExtendDocument> DocumentProcessorChain::createExtendDocument() c
 ProcessedDocumentVecPtr DocumentProcessorChain::batchProcess(const RawDocumentVecPtr& batchRawDocs)
 {
     ExtendDocument::ExtendDocumentVec extDocVec;
+    batchProcessRawDocs(batchRawDocs, extDocVec);
+    return batchHandleExtendDocs(extDocVec);
+}
+
+void DocumentProcessorChain::batchProcessRawDocs(const RawDocumentVecPtr& batchRawDocs,
+                                                 ExtendDocument::ExtendDocumentVec& extDocVec)
+{
+    extDocVec.clear();
     extDocVec.reserve(batchRawDocs->size());
 
     for (size_t i = 0; i < batchRawDocs->size(); i++) {
@@ -134,8 +142,13 @@ ProcessedDocumentVecPtr DocumentProcessorChain::batchProcess(const RawDocumentVe
         IE_RAW_DOC_TRACE((*batchRawDocs)[i], "process begin");
     }
     batchProcessExtendDocs(extDocVec);
+}
+
+ProcessedDocumentVecPtr
+DocumentProcessorChain::batchHandleExtendDocs(const ExtendDocument::ExtendDocumentVec& extDocVec)
+{
     ProcessedDocumentVecPtr ret(new ProcessedDocumentVec);
-    ret->reserve(batchRawDocs->size());
+    ret->reserve(extDocVec.size());
     for (size_t i = 0; i < extDocVec.size(); i++) {
         ProcessedDocumentPtr processedDoc = handleExtendDocument(extDocVec[i]);
         const RawDocumentPtr& rawDoc = extDocVec[i]->getRawDocument();
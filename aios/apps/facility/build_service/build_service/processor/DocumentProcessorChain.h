@@ -53,6 +53,13 @@ public:
 
     document::ProcessedDocumentVecPtr batchProcess(const document::RawDocumentVecPtr& batchRawDocs);
 
+    // batchProcess in two steps, processors run in the first one and index documents are parsed in the second,
+    // so that a pipelined executor can run them on different threads.
+    void batchProcessRawDocs(const document::RawDocumentVecPtr& batchRawDocs,
+                             document::ExtendDocument::ExtendDocumentVec& extDocVec);
+    document::ProcessedDocumentVecPtr
+    batchHandleExtendDocs(const document::ExtendDocument::ExtendDocumentVec& extDocVec);
+
     virtual DocumentProcessorChain* clone() = 0;
 
     void setTolerateFieldFormatError(bool tolerateFormatError) { _tolerateFormatError = tolerateFormatError; }
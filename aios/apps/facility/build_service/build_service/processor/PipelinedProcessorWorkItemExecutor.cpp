@@ -0,0 +1,149 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "build_service/processor/PipelinedProcessorWorkItemExecutor.h"
+
+using namespace std;
+
+namespace build_service { namespace processor {
+BS_LOG_SETUP(processor, PipelinedProcessorWorkItemExecutor);
+
+namespace {
+class ParseWorkItem : public autil::WorkItem
+{
+public:
+    explicit ParseWorkItem(ProcessorWorkItem* workItem) : _workItem(workItem) {}
+    ~ParseWorkItem() { DELETE_AND_SET_NULL(_workItem); }
+
+public:
+    void process() override { _workItem->finishProcess(); }
+    ProcessorWorkItem* stealWorkItem()
+    {
+        ProcessorWorkItem* workItem = _workItem;
+        _workItem = NULL;
+        return workItem;
+    }
+
+private:
+    ProcessorWorkItem* _workItem;
+};
+} // namespace
+
+PipelinedProcessorWorkItemExecutor::PipelinedProcessorWorkItemExecutor(uint32_t processThreadNum,
+                                                                       uint32_t parseThreadNum, uint32_t queueSize)
+    : _stopped(false)
+{
+    _processThreadPool.reset(new autil::OutputOrderedThreadPool(processThreadNum, queueSize));
+    _parseThreadPool.reset(new autil::OutputOrderedThreadPool(parseThreadNum, queueSize));
+}
+
+PipelinedProcessorWorkItemExecutor::~PipelinedProcessorWorkItemExecutor()
+{
+    stop(/*instant*/ false);
+
+    // pop until parse stage is stopped by forward thread
+    ProcessorWorkItem* item = pop();
+    if (item != NULL) {
+        BS_LOG(WARN, "some processor work itmes still in queue, drop them");
+    }
+    while (item != NULL) {
+        DELETE_AND_SET_NULL(item);
+        item = pop();
+    }
+}
+
+bool PipelinedProcessorWorkItemExecutor::start()
+{
+    if (!_processThreadPool->start("BsProcess") || !_parseThreadPool->start("BsParse")) {
+        BS_LOG(ERROR, "start processor thread pools failed");
+        return false;
+    }
+    _forwardThread =
+        autil::Thread::createThread(std::bind(&PipelinedProcessorWorkItemExecutor::forwardLoop, this), "BsForward");
+    if (!_forwardThread) {
+        BS_LOG(ERROR, "create processor forward thread failed");
+        return false;
+    }
+    return true;
+}
+
+bool PipelinedProcessorWorkItemExecutor::push(ProcessorWorkItem* workItem)
+{
+    if (workItem == NULL) {
+        return false;
+    }
+    workItem->enableSeparateFinish();
+    return _processThreadPool->pushWorkItem(workItem);
+}
+
+void PipelinedProcessorWorkItemExecutor::forwardLoop()
+{
+    // pop returns NULL only after process thread pool is stopped and drained
+    while (true) {
+        auto workItem = static_cast<ProcessorWorkItem*>(_processThreadPool->popWorkItem());
+        if (workItem == NULL) {
+            break;
+        }
+        ParseWorkItem* parseWorkItem = new ParseWorkItem(workItem);
+        if (!_parseThreadPool->pushWorkItem(parseWorkItem)) {
+            BS_LOG(WARN, "push work item to parse stage failed, drop it");
+            delete parseWorkItem;
+        }
+    }
+    // all items are forwarded, parse stage can be stopped now
+    _parseThreadPool->waitStop(autil::ThreadPool::STOP_AFTER_QUEUE_EMPTY);
+}
+
+ProcessorWorkItem* PipelinedProcessorWorkItemExecutor::pop()
+{
+    auto parseWorkItem = static_cast<ParseWorkItem*>(_parseThreadPool->popWorkItem());
+    if (parseWorkItem == NULL) {
+        return NULL;
+    }
+    ProcessorWorkItem* workItem = parseWorkItem->stealWorkItem();
+    delete parseWorkItem;
+    return workItem;
+}
+
+void PipelinedProcessorWorkItemExecutor::stop(bool instant)
+{
+    if (_stopped) {
+        return;
+    }
+    // forward thread stops parse stage after process stage is drained. not joined here when stop after queue
+    // empty, it may wait for pop to free space of parse stage.
+    if (instant) {
+        _processThreadPool->waitStop(autil::ThreadPool::STOP_AND_CLEAR_QUEUE_IGNORE_EXCEPTION);
+        _parseThreadPool->waitStop(autil::ThreadPool::STOP_AND_CLEAR_QUEUE_IGNORE_EXCEPTION);
+        if (_forwardThread) {
+            _forwardThread->join();
+        }
+    } else {
+        _processThreadPool->waitStop(autil::ThreadPool::STOP_AFTER_QUEUE_EMPTY);
+        if (!_forwardThread) {
+            _parseThreadPool->waitStop(autil::ThreadPool::STOP_AFTER_QUEUE_EMPTY);
+        }
+    }
+    _stopped = true;
+}
+
+uint32_t PipelinedProcessorWorkItemExecutor::getWaitItemCount()
+{
+    return _processThreadPool->getWaitItemCount() + _parseThreadPool->getWaitItemCount();
+}
+
+uint32_t PipelinedProcessorWorkItemExecutor::getOutputItemCount() { return _parseThreadPool->getOutputItemCount(); }
+
+}} // namespace build_service::processor
@@ -22,6 +22,7 @@
 #include "build_service/processor/DocumentProcessorChainCreator.h"
 #include "build_service/processor/DocumentProcessorChainCreatorV2.h"
 #include "build_service/processor/MultiThreadProcessorWorkItemExecutor.h"
+#include "build_service/processor/PipelinedProcessorWorkItemExecutor.h"
 #include "build_service/processor/ProcessorChainSelector.h"
 #include "build_service/processor/ProcessorWorkItem.h"
 #include "build_service/processor/RegionDocumentProcessor.h"
@@ -98,7 +99,18 @@ bool Processor::start(const config::ProcessorConfigReaderPtr& resourceReaderPtr,
         return false;
     }
 
-    if (!forceSingleThreaded && processorConfig.processorThreadNum > 1) {
+    bool usePipeline = processorConfig.processorParseThreadNum > 0;
+    if (usePipeline && processorConfig.processorStrategyStr != ProcessorConfig::BATCH_PROCESSOR_STRATEGY) {
+        // a work item of normal strategy holds one document, parsing it on another stage costs more than it saves
+        BS_LOG(WARN, "processor_parse_thread_num [%u] only works with batch processor_strategy, current [%s]",
+               processorConfig.processorParseThreadNum, processorConfig.processorStrategyStr.c_str());
+        usePipeline = false;
+    }
+    if (!forceSingleThreaded && usePipeline) {
+        _executor.reset(new PipelinedProcessorWorkItemExecutor(processorConfig.processorThreadNum,
+                                                               processorConfig.processorParseThreadNum,
+                                                               processorConfig.processorQueueSize));
+    } else if (!forceSingleThreaded && processorConfig.processorThreadNum > 1) {
         _executor.reset(new MultiThreadProcessorWorkItemExecutor(processorConfig.processorThreadNum,
                                                                  processorConfig.processorQueueSize));
     } else {
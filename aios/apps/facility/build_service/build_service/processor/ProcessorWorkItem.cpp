@@ -37,6 +37,8 @@ ProcessorWorkItem::ProcessorWorkItem(const DocumentProcessorChainVecPtr& chains,
     , _chainSelector(chainSelector)
     , _enableRewriteDeleteSubDoc(enableRewriteDeleteSubDoc)
     , _reporter(reporter)
+    , _separateFinish(false)
+    , _needFinish(false)
 {
 }
 
@@ -67,6 +69,30 @@ void ProcessorWorkItem::batchProcess()
     } else {
         batchProcessWithCustomizeChainSelector();
     }
+    _needFinish = true;
+    if (!_separateFinish) {
+        finishProcess();
+    }
+}
+
+void ProcessorWorkItem::finishProcess()
+{
+    if (!_needFinish) {
+        return;
+    }
+    _needFinish = false;
+    {
+        ScopeLatencyReporter endBatchScopeTime(_reporter->_endBatchProcessLatencyMetric.get());
+        if (_chainSelector->alwaysSelectAllChains()) {
+            finishBatchWithAllChainSelector();
+        } else {
+            finishBatchWithCustomizeChainSelector();
+        }
+    }
+    _batchChains.clear();
+    _extDocsForChains.clear();
+    _rawDocsForChains.clear();
+    _chainIdQueue.clear();
     if (_processedDocumentVecPtr->empty()) {
         _processedDocumentVecPtr.reset();
     }
@@ -213,41 +239,43 @@ ProcessorWorkItem::getRawDocumentsForEachChain(const RawDocumentVecPtr& batchRaw
 void ProcessorWorkItem::batchProcessWithCustomizeChainSelector()
 {
     assert(_batchRawDocsPtr);
-    vector<RawDocumentVecPtr> rawDocsForChains;
-    vector<const ProcessorChainSelector::ChainIdVector*> chainIdQueue;
-    size_t count = getRawDocumentsForEachChain(_batchRawDocsPtr, rawDocsForChains, chainIdQueue);
+    size_t count = getRawDocumentsForEachChain(_batchRawDocsPtr, _rawDocsForChains, _chainIdQueue);
     _processedDocumentVecPtr.reset(new ProcessedDocumentVec());
     _processedDocumentVecPtr->reserve(count);
+    _batchChains.resize(_chains->size());
+    _extDocsForChains.resize(_chains->size());
 
-    vector<ProcessedDocumentVecPtr> processDocsForChains;
-    processDocsForChains.reserve(_chains->size());
-
-    {
-        ScopeLatencyReporter chainScopeTime(_reporter->_chainProcessLatencyMetric.get());
-        for (size_t i = 0; i < _chains->size(); i++) {
-            if (!rawDocsForChains[i] || rawDocsForChains[i]->size() == 0) {
-                processDocsForChains.push_back(ProcessedDocumentVecPtr());
-                continue;
-            }
-            DocumentProcessorChainPtr chain((*_chains)[i]->clone());
-            assert(i < rawDocsForChains.size());
+    ScopeLatencyReporter chainScopeTime(_reporter->_chainProcessLatencyMetric.get());
+    for (size_t i = 0; i < _chains->size(); i++) {
+        assert(i < _rawDocsForChains.size());
+        if (!_rawDocsForChains[i] || _rawDocsForChains[i]->size() == 0) {
+            continue;
+        }
+        _batchChains[i].reset((*_chains)[i]->clone());
+        _batchChains[i]->batchProcessRawDocs(_rawDocsForChains[i], _extDocsForChains[i]);
+    }
+}
 
-            ProcessedDocumentVecPtr processDocVec = chain->batchProcess(rawDocsForChains[i]);
-            assert(processDocVec);
-            assert(processDocVec->size() == rawDocsForChains[i]->size());
-            processDocsForChains.push_back(processDocVec);
+void ProcessorWorkItem::finishBatchWithCustomizeChainSelector()
+{
+    vector<ProcessedDocumentVecPtr> processDocsForChains(_batchChains.size());
+    for (size_t i = 0; i < _batchChains.size(); i++) {
+        if (!_batchChains[i]) {
+            continue;
         }
+        processDocsForChains[i] = _batchChains[i]->batchHandleExtendDocs(_extDocsForChains[i]);
+        assert(processDocsForChains[i]);
+        assert(processDocsForChains[i]->size() == _rawDocsForChains[i]->size());
     }
 
-    ScopeLatencyReporter endBatchScopeTime(_reporter->_endBatchProcessLatencyMetric.get());
     // pushback to vector by batchIdx
     vector<size_t> idxForEachChain(_chains->size(), 0);
-    for (auto chainIds : chainIdQueue) {
+    for (auto chainIds : _chainIdQueue) {
         for (auto chainId : *chainIds) {
             const ProcessedDocumentVec& pDocs = *processDocsForChains[chainId];
             size_t idx = idxForEachChain[chainId];
             ProcessedDocumentPtr pDoc = pDocs[idx];
-            assembleProcessedDoc(chainId, (*rawDocsForChains[chainId])[idx], pDoc);
+            assembleProcessedDoc(chainId, (*_rawDocsForChains[chainId])[idx], pDoc);
             _processedDocumentVecPtr->push_back(pDoc);
             ++idxForEachChain[chainId];
         }
@@ -259,36 +287,42 @@ void ProcessorWorkItem::batchProcessWithAllChainSelector()
     assert(_batchRawDocsPtr);
     _processedDocumentVecPtr.reset(new ProcessedDocumentVec());
     _processedDocumentVecPtr->reserve(_chains->size() * _batchRawDocsPtr->size());
-    vector<ProcessedDocumentVecPtr> processDocsForChains;
-    processDocsForChains.reserve(_chains->size());
+    _batchChains.resize(_chains->size());
+    _extDocsForChains.resize(_chains->size());
 
-    {
-        ScopeLatencyReporter chainScopeTime(_reporter->_chainProcessLatencyMetric.get());
-        RawDocumentVecPtr rawDocsForChain;
-        for (size_t i = 0; i < _chains->size(); i++) {
-            if (i != _chains->size() - 1) {
-                if (!rawDocsForChain) {
-                    rawDocsForChain.reset(new RawDocumentVec);
-                    rawDocsForChain->reserve(_batchRawDocsPtr->size());
-                } else {
-                    rawDocsForChain->clear();
-                }
-                for (size_t idx = 0; idx < _batchRawDocsPtr->size(); idx++) {
-                    RawDocumentPtr processRawDocPtr((*_batchRawDocsPtr)[idx]->clone());
-                    rawDocsForChain->push_back(processRawDocPtr);
-                }
+    ScopeLatencyReporter chainScopeTime(_reporter->_chainProcessLatencyMetric.get());
+    RawDocumentVecPtr rawDocsForChain;
+    for (size_t i = 0; i < _chains->size(); i++) {
+        if (i != _chains->size() - 1) {
+            if (!rawDocsForChain) {
+                rawDocsForChain.reset(new RawDocumentVec);
+                rawDocsForChain->reserve(_batchRawDocsPtr->size());
             } else {
-                rawDocsForChain = _batchRawDocsPtr;
+                rawDocsForChain->clear();
+            }
+            for (size_t idx = 0; idx < _batchRawDocsPtr->size(); idx++) {
+                RawDocumentPtr processRawDocPtr((*_batchRawDocsPtr)[idx]->clone());
+                rawDocsForChain->push_back(processRawDocPtr);
             }
-            DocumentProcessorChainPtr chain((*_chains)[i]->clone());
-            ProcessedDocumentVecPtr processDocVec = chain->batchProcess(rawDocsForChain);
-            assert(processDocVec);
-            assert(processDocVec->size() == rawDocsForChain->size());
-            processDocsForChains.push_back(processDocVec);
+        } else {
+            rawDocsForChain = _batchRawDocsPtr;
         }
+        _batchChains[i].reset((*_chains)[i]->clone());
+        _batchChains[i]->batchProcessRawDocs(rawDocsForChain, _extDocsForChains[i]);
+    }
+}
+
+void ProcessorWorkItem::finishBatchWithAllChainSelector()
+{
+    vector<ProcessedDocumentVecPtr> processDocsForChains;
+    processDocsForChains.reserve(_batchChains.size());
+    for (size_t i = 0; i < _batchChains.size(); i++) {
+        ProcessedDocumentVecPtr processDocVec = _batchChains[i]->batchHandleExtendDocs(_extDocsForChains[i]);
+        assert(processDocVec);
+        assert(processDocVec->size() == _batchRawDocsPtr->size());
+        processDocsForChains.push_back(processDocVec);
     }
 
-    ScopeLatencyReporter endBatchScopeTime(_reporter->_endBatchProcessLatencyMetric.get());
     for (size_t i = 0; i < _batchRawDocsPtr->size(); i++) {
         for (size_t chainId = 0; chainId < processDocsForChains.size(); ++chainId) {
             const ProcessedDocumentVec& pDocs = *processDocsForChains[chainId];
@@ -53,6 +53,10 @@ public:
 
 public:
     void process() override;
+    // with separate finish, process() stops after the processors of batch docs and finishProcess() parses index
+    // documents, so a pipelined executor can run the two halves of different batches at the same time.
+    void enableSeparateFinish() { _separateFinish = true; }
+    void finishProcess();
     void setProcessErrorCounter(const indexlib::util::AccumulativeCounterPtr& processErrorCounter)
     {
         _processErrorCounter = processErrorCounter;
@@ -77,6 +81,8 @@ private:
 
     void batchProcessWithCustomizeChainSelector();
     void batchProcessWithAllChainSelector();
+    void finishBatchWithCustomizeChainSelector();
+    void finishBatchWithAllChainSelector();
 
 private:
     // input
@@ -86,6 +92,14 @@ private:
     // output
     document::ProcessedDocumentVecPtr _processedDocumentVecPtr;
 
+    // batch docs between process and finish
+    std::vector<DocumentProcessorChainPtr> _batchChains;
+    std::vector<document::ExtendDocument::ExtendDocumentVec> _extDocsForChains;
+    std::vector<document::RawDocumentVecPtr> _rawDocsForChains;
+    std::vector<const ProcessorChainSelector::ChainIdVector*> _chainIdQueue;
+    bool _separateFinish;
+    bool _needFinish;
+
     // const
     DocumentProcessorChainVecPtr _chains;
     ProcessorChainSelectorPtr _chainSelector;
@@ -57,9 +57,28 @@ bool TokenizeDocumentProcessor::init(const DocProcessorInitParam& param)
 
 void TokenizeDocumentProcessor::batchProcess(const std::vector<ExtendDocumentPtr>& docs)
 {
+    std::vector<indexlibv2::document::TokenizeDocumentConvertor::BatchItem> batchItems;
+    std::vector<size_t> docIdxs;
+    batchItems.reserve(docs.size());
+    docIdxs.reserve(docs.size());
     for (size_t i = 0; i < docs.size(); i++) {
-        if (!process(docs[i])) {
-            docs[i]->setWarningFlag(ProcessorWarningFlag::PWF_PROCESS_FAIL_IN_BATCH);
+        const TokenizeDocumentPtr& tokenizeDocument = docs[i]->getTokenizeDocument();
+        if (!tokenizeDocument) {
+            ERROR_COLLECTOR_LOG(WARN, "get tokenize document failed");
+            continue;
+        }
+        indexlibv2::document::TokenizeDocumentConvertor::BatchItem item;
+        item.rawDoc = docs[i]->getExtendDoc()->getRawDocument().get();
+        item.fieldAnalyzerNameMap = &docs[i]->getFieldAnalyzerNameMap();
+        item.tokenizeDocument = tokenizeDocument;
+        item.lastTokenizeDocument = docs[i]->getLastTokenizeDocument();
+        batchItems.push_back(std::move(item));
+        docIdxs.push_back(i);
+    }
+    _impl->BatchConvert(batchItems);
+    for (size_t i = 0; i < batchItems.size(); i++) {
+        if (!batchItems[i].success) {
+            docs[docIdxs[i]]->setWarningFlag(ProcessorWarningFlag::PWF_PROCESS_FAIL_IN_BATCH);
         }
     }
 }
@@ -26,6 +26,7 @@ static const std::string RAW_DOCUMENT_SEP_PREFIX = "separator_prefix";
 static const std::string RAW_DOCUMENT_SEP_SUFFIX = "separator_suffix";
 static const std::string RAW_DOCUMENT_FIELD_SEP = "field_separator";
 static const std::string RAW_DOCUMENT_KV_SEP = "kv_separator";
+static const std::string RAW_DOCUMENT_ZERO_COPY_PARSE = "zero_copy_parse";
 
 // ha3 document format
 static const std::string RAW_DOCUMENT_HA3_DOCUMENT_FORMAT = "ha3";
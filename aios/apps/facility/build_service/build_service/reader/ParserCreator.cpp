@@ -111,6 +111,10 @@ bool ParserCreator::createParserConfigForLegacyConfig(const KeyValueMap& kvMap,
         }
     }
 
+    string zeroCopyParse = getValueFromKeyValueMap(kvMap, RAW_DOCUMENT_ZERO_COPY_PARSE);
+    if (!zeroCopyParse.empty()) {
+        parserConfig.parameters[RAW_DOCUMENT_ZERO_COPY_PARSE] = zeroCopyParse;
+    }
     string format = getValueFromKeyValueMap(kvMap, RAW_DOCUMENT_FORMAT);
     if (format.empty()) {
         parserConfig.type = RAW_DOCUMENT_FORMAT_CUSTOMIZED;
@@ -154,11 +158,14 @@ RawDocumentParser* ParserCreator::doCreateParser(const vector<ParserConfig>& par
 
 RawDocumentParser* ParserCreator::createSingleParser(const ParserConfig& parserConfig)
 {
+    bool zeroCopyParse =
+        getValueFromKeyValueMap(parserConfig.parameters, RAW_DOCUMENT_ZERO_COPY_PARSE, "false") == "true";
     if (parserConfig.type == RAW_DOCUMENT_HA3_DOCUMENT_FORMAT) {
-        return new StandardRawDocumentParser(RAW_DOCUMENT_HA3_FIELD_SEP, RAW_DOCUMENT_HA3_KV_SEP);
+        return new StandardRawDocumentParser(RAW_DOCUMENT_HA3_FIELD_SEP, RAW_DOCUMENT_HA3_KV_SEP, zeroCopyParse);
     }
     if (parserConfig.type == RAW_DOCUMENT_ISEARCH_DOCUMENT_FORMAT) {
-        return new StandardRawDocumentParser(RAW_DOCUMENT_ISEARCH_FIELD_SEP, RAW_DOCUMENT_ISEARCH_KV_SEP);
+        return new StandardRawDocumentParser(RAW_DOCUMENT_ISEARCH_FIELD_SEP, RAW_DOCUMENT_ISEARCH_KV_SEP,
+                                             zeroCopyParse);
     }
     if (parserConfig.type == RAW_DOCUMENT_FORMAT_SELF_EXPLAIN) {
         string fieldName = getValueFromKeyValueMap(parserConfig.parameters, DOC_STRING_FIELD_NAME);
@@ -176,7 +183,7 @@ RawDocumentParser* ParserCreator::createSingleParser(const ParserConfig& parserC
                             fieldSep + ", keyValueSep: " + keyValueSep + " can't be empty";
             return NULL;
         }
-        return new StandardRawDocumentParser(fieldSep, keyValueSep);
+        return new StandardRawDocumentParser(fieldSep, keyValueSep, zeroCopyParse);
     }
     if (parserConfig.type == RAW_DOCUMENT_FORMAT_SWIFT_FILED_FILTER) {
         return new SwiftFieldFilterRawDocumentParser();
@@ -16,9 +16,17 @@
 #ifndef ISEARCH_BS_SEPARATOR_H
 #define ISEARCH_BS_SEPARATOR_H
 
+#include <cstring>
+
 #include "build_service/common_define.h"
 #include "build_service/util/Log.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace build_service { namespace reader {
 
 class Separator
@@ -39,6 +47,9 @@ public:
     bool isEmpty() { return _sep.empty(); }
     const std::string& getSeperator() const { return _sep; }
 
+private:
+    const char* simdFindInBuffer(const char* buffer, const char* end) const;
+
 private:
     std::string _sep;
     int32_t _next[256];
@@ -48,6 +59,11 @@ inline const char* Separator::findInBuffer(const char* buffer, const char* end)
 {
     size_t sepLen = _sep.size();
     const char* sepBegin = _sep.data();
+#if defined(__AVX2__) || defined(__SSE2__)
+    if (sepLen > 0) {
+        return simdFindInBuffer(buffer, end);
+    }
+#endif
     if (sepLen <= 4) {
         const char* ret = std::search(buffer, end, sepBegin, sepBegin + sepLen);
         return ret != end ? ret : NULL;
@@ -74,6 +90,49 @@ inline const char* Separator::findInBuffer(const char* buffer, const char* end)
     return NULL;
 }
 
+// compare first and last byte of separator at a block of positions at once, only verify positions both match.
+inline const char* Separator::simdFindInBuffer(const char* buffer, const char* end) const
+{
+#if defined(__AVX2__)
+    typedef __m256i Block;
+#define BS_SEP_LOAD(p) _mm256_loadu_si256((const __m256i*)(p))
+#define BS_SEP_SET1(c) _mm256_set1_epi8(c)
+#define BS_SEP_MATCH_MASK(a, b, c, d)                                                                                  \
+    (uint32_t) _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, b), _mm256_cmpeq_epi8(c, d)))
+#elif defined(__SSE2__)
+    typedef __m128i Block;
+#define BS_SEP_LOAD(p) _mm_loadu_si128((const __m128i*)(p))
+#define BS_SEP_SET1(c) _mm_set1_epi8(c)
+#define BS_SEP_MATCH_MASK(a, b, c, d) (uint32_t) _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, b), _mm_cmpeq_epi8(c, d)))
+#endif
+#if defined(__AVX2__) || defined(__SSE2__)
+    size_t sepLen = _sep.size();
+    const char* sepBegin = _sep.data();
+    const Block firstByte = BS_SEP_SET1(sepBegin[0]);
+    const Block lastByte = BS_SEP_SET1(sepBegin[sepLen - 1]);
+    const char* cur = buffer;
+    while (end - cur >= (ptrdiff_t)(sizeof(Block) + sepLen - 1)) {
+        uint32_t mask = BS_SEP_MATCH_MASK(firstByte, BS_SEP_LOAD(cur), lastByte, BS_SEP_LOAD(cur + sepLen - 1));
+        while (mask != 0) {
+            const char* candidate = cur + __builtin_ctz(mask);
+            if (memcmp(candidate, sepBegin, sepLen) == 0) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+        cur += sizeof(Block);
+    }
+#undef BS_SEP_LOAD
+#undef BS_SEP_SET1
+#undef BS_SEP_MATCH_MASK
+    const char* ret = std::search(cur, end, sepBegin, sepBegin + sepLen);
+    return ret != end ? ret : NULL;
+#else
+    assert(false);
+    return NULL;
+#endif
+}
+
 }} // namespace build_service::reader
 
 #endif // ISEARCH_BS_SEPARATOR_H
@@ -15,6 +15,8 @@
  */
 #include "build_service/reader/StandardRawDocumentParser.h"
 
+#include "autil/ConstString.h"
+
 using namespace std;
 using namespace autil;
 using namespace build_service::document;
@@ -23,9 +25,10 @@ namespace build_service { namespace reader {
 
 BS_LOG_SETUP(reader, StandardRawDocumentParser);
 
-StandardRawDocumentParser::StandardRawDocumentParser(const string& fieldSep, const string& keyValueSep)
+StandardRawDocumentParser::StandardRawDocumentParser(const string& fieldSep, const string& keyValueSep, bool zeroCopy)
     : _fieldSep(fieldSep)
     , _keyValueSep(keyValueSep)
+    , _zeroCopy(zeroCopy)
 {
 }
 
@@ -35,6 +38,11 @@ bool StandardRawDocumentParser::parse(const string& docString, RawDocument& rawD
 {
     const char* docCursor = docString.data();
     const char* docEnd = docString.data() + docString.size();
+    if (_zeroCopy) {
+        StringView docBuffer = autil::MakeCString(docString.data(), docString.size(), rawDoc.getPool());
+        docCursor = docBuffer.data();
+        docEnd = docBuffer.data() + docBuffer.size();
+    }
 
     while (docCursor < docEnd) {
         pair<const char*, size_t> fieldName = findNext(_keyValueSep, docCursor, docEnd);
@@ -60,7 +68,16 @@ bool StandardRawDocumentParser::parse(const string& docString, RawDocument& rawD
             BS_LOG(WARN, "%s", errorMsg.c_str());
             continue;
         }
-        rawDoc.setField(fieldName.first, fieldName.second, fieldValue.first, fieldValue.second);
+        if (_zeroCopy) {
+            // the buffer is owned by the pool, terminate name and value in place for c-string consumers,
+            // the byte after each of them is a separator already consumed or the terminator of the buffer
+            const_cast<char*>(fieldName.first)[fieldName.second] = '\0';
+            const_cast<char*>(fieldValue.first)[fieldValue.second] = '\0';
+            rawDoc.setFieldNoCopy(StringView(fieldName.first, fieldName.second),
+                                  StringView(fieldValue.first, fieldValue.second));
+        } else {
+            rawDoc.setField(fieldName.first, fieldName.second, fieldValue.first, fieldValue.second);
+        }
     }
     if (rawDoc.getFieldCount() == 0) {
         BS_LOG(WARN,
@@ -26,7 +26,9 @@ namespace build_service { namespace reader {
 class StandardRawDocumentParser : public RawDocumentParser
 {
 public:
-    StandardRawDocumentParser(const std::string& fieldSep, const std::string& keyValueSep);
+    // with zeroCopy, doc string is copied into pool of raw doc once and field names and values reference the
+    // copy, each of them is null terminated in place.
+    StandardRawDocumentParser(const std::string& fieldSep, const std::string& keyValueSep, bool zeroCopy = false);
     ~StandardRawDocumentParser();
 
 private:
@@ -49,6 +51,7 @@ private:
 private:
     Separator _fieldSep;
     Separator _keyValueSep;
+    bool _zeroCopy;
 
 private:
     BS_LOG_DECLARE();
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "build_service/util/SystemLoadUtil.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace build_service { namespace util {
+BS_LOG_SETUP(util, SystemLoadUtil);
+
+bool SystemLoadUtil::getRunningThreadCount(uint32_t& runningCount)
+{
+    FILE* fp = fopen("/proc/stat", "r");
+    if (!fp) {
+        BS_LOG(WARN, "open /proc/stat failed");
+        return false;
+    }
+    static const char* PROCS_RUNNING = "procs_running ";
+    char line[256];
+    bool found = false;
+    while (fgets(line, sizeof(line), fp)) {
+        if (strncmp(line, PROCS_RUNNING, strlen(PROCS_RUNNING)) == 0) {
+            found = sscanf(line + strlen(PROCS_RUNNING), "%u", &runningCount) == 1;
+            break;
+        }
+    }
+    fclose(fp);
+    return found;
+}
+
+uint32_t SystemLoadUtil::getCpuCount()
+{
+    long cpuCount = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpuCount > 0 ? (uint32_t)cpuCount : 1;
+}
+
+}} // namespace build_service::util
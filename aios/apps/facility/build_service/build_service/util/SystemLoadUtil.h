@@ -0,0 +1,34 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "build_service/common_define.h"
+#include "build_service/util/Log.h"
+
+namespace build_service { namespace util {
+
+class SystemLoadUtil
+{
+public:
+    // runnable threads of the machine (procs_running in /proc/stat)
+    static bool getRunningThreadCount(uint32_t& runningCount);
+    static uint32_t getCpuCount();
+
+private:
+    BS_LOG_DECLARE();
+};
+
+}} // namespace build_service::util
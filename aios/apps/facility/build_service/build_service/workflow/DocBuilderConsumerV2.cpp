@@ -51,6 +51,9 @@ FlowError DocBuilderConsumerV2::consume(const document::ProcessedDocumentVecPtr&
     if (_builder->hasFatalError()) {
         return FE_FATAL;
     }
+    if (auto limiter = _builder->getBuildRateLimiter()) {
+        limiter->acquire(batch->GetValidDocCount());
+    }
     if (_builder->build(batch)) {
         return FE_OK;
     }
@@ -117,6 +117,22 @@ bool RealtimeBuilderImplV2::prepareIntervalTask(const ResourceReaderPtr& resourc
     }
 
     BS_PREFIX_LOG(INFO, "recover latency set to [%ld]", _recoverLatency);
+
+    AdaptiveBuildConfig adaptiveBuildConfig;
+    if (!resourceReader->getConfigWithJsonPath(relativePath, "build_option_config.adaptive_build_control",
+                                               adaptiveBuildConfig)) {
+        BS_PREFIX_LOG(ERROR, "fail to read adaptive_build_control from config path %s", relativePath.c_str());
+        return false;
+    }
+    if (adaptiveBuildConfig.enable) {
+        if (!adaptiveBuildConfig.validate()) {
+            BS_PREFIX_LOG(ERROR, "invalid adaptive_build_control [%s]",
+                          autil::legacy::ToJsonString(adaptiveBuildConfig, true).c_str());
+            return false;
+        }
+        _adaptiveBuildController.reset(new AdaptiveBuildController(adaptiveBuildConfig, LOG_PREFIX));
+        _adaptiveBuildController->init(_tablet, metricProvider);
+    }
     _startRecoverTime = TimeUtility::currentTimeInSeconds();
     setIsRecovered(false);
 
@@ -160,6 +176,8 @@ void RealtimeBuilderImplV2::executeBuildControlTask()
 
     checkRecoverBuild();
 
+    adaptiveBuildControl();
+
     externalActions();
 }
 
@@ -226,6 +244,19 @@ void RealtimeBuilderImplV2::checkRecoverBuild()
     }
 }
 
+void RealtimeBuilderImplV2::adaptiveBuildControl()
+{
+    if (!_adaptiveBuildController) {
+        return;
+    }
+    // the builder is recreated when the build flow reconstructs
+    const auto& limiter = _adaptiveBuildController->getBuildRateLimiter();
+    if (_builder->getBuildRateLimiter() != limiter) {
+        _builder->setBuildRateLimiter(limiter);
+    }
+    _adaptiveBuildController->tick();
+}
+
 void RealtimeBuilderImplV2::stopTask()
 {
     if (_tasker) {
@@ -241,6 +272,9 @@ void RealtimeBuilderImplV2::stop(StopOption stopOption)
     BS_PREFIX_LOG(INFO, "stop realtime buildflow");
     _starter.stop();
     stopTask();
+    if (_adaptiveBuildController) {
+        _adaptiveBuildController->stop();
+    }
     if (_buildFlow.get()) {
         _buildFlow->stop(stopOption);
     }
@@ -19,6 +19,7 @@
 #include <chrono>
 #include <mutex>
 
+#include "build_service/builder/AdaptiveBuildController.h"
 #include "build_service/common_define.h"
 #include "build_service/config/ResourceReader.h"
 #include "build_service/proto/BasicDefs.pb.h"
@@ -102,6 +103,7 @@ private:
     bool needAutoResume();
     void autoSuspend();
     void autoResume();
+    void adaptiveBuildControl();
     void stopTask();
     void setIsRecovered(bool isRecovered);
 
@@ -142,6 +144,7 @@ private:
     int32_t _buildCtrlTaskId;
     future_lite::TaskScheduler::Handle _buildCtrlTaskHandle;
     std::function<void()> _reconstructor;
+    builder::AdaptiveBuildControllerPtr _adaptiveBuildController;
 
 protected:
     proto::PartitionId _partitionId;
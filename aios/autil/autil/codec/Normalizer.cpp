@@ -15,6 +15,11 @@
  */
 #include <stdlib.h>
 #include <string.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include <cstdint>
 #include <iosfwd>
 #include <map>
@@ -43,6 +48,7 @@ Normalizer::Normalizer(const NormalizeOptions &options, const map<uint16_t, uint
              options.widthSensitive,
              traditionalTablePatch)
 {
+    initASCIITable();
 }
 
 Normalizer::~Normalizer() {
@@ -92,6 +98,74 @@ void Normalizer::normalize(const string &word, string &normalizeWord) {
     normalizeWord.assign(buf8);
 }
 
+void Normalizer::initASCIITable() {
+    _asciiClosed = true;
+    _asciiIdentity = true;
+    _asciiLowerCase = true;
+    for (uint16_t i = 0; i < 128; ++i) {
+        uint16_t normalized = _table[i];
+        if (normalized >= 128) {
+            _asciiClosed = false;
+            return;
+        }
+        _asciiTable[i] = (char)normalized;
+        uint16_t lower = (i >= 'A' && i <= 'Z') ? i + ('a' - 'A') : i;
+        _asciiIdentity = _asciiIdentity && normalized == i;
+        _asciiLowerCase = _asciiLowerCase && normalized == lower;
+    }
+}
+
+bool Normalizer::normalizeASCII(const char *in, size_t len, char *out) const {
+    if (!_asciiClosed) {
+        return false;
+    }
+    size_t i = 0;
+    // only identity and lower case tables have simd blocks, other tables go byte by byte
+    bool simdBlock = _asciiIdentity || _asciiLowerCase;
+#if defined(__AVX2__)
+    const __m256i upperBegin = _mm256_set1_epi8('A' - 1);
+    const __m256i upperEnd = _mm256_set1_epi8('Z' + 1);
+    const __m256i caseBit = _mm256_set1_epi8('a' - 'A');
+    for (; simdBlock && i + 32 <= len; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(in + i));
+        if (_mm256_movemask_epi8(block) != 0) {
+            return false;
+        }
+        if (_asciiLowerCase) {
+            __m256i isUpper = _mm256_and_si256(_mm256_cmpgt_epi8(block, upperBegin),
+                                               _mm256_cmpgt_epi8(upperEnd, block));
+            block = _mm256_or_si256(block, _mm256_and_si256(isUpper, caseBit));
+        }
+        _mm256_storeu_si256((__m256i *)(out + i), block);
+    }
+#elif defined(__SSE2__)
+    const __m128i upperBegin = _mm_set1_epi8('A' - 1);
+    const __m128i upperEnd = _mm_set1_epi8('Z' + 1);
+    const __m128i caseBit = _mm_set1_epi8('a' - 'A');
+    for (; simdBlock && i + 16 <= len; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *)(in + i));
+        if (_mm_movemask_epi8(block) != 0) {
+            return false;
+        }
+        if (_asciiLowerCase) {
+            __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi8(block, upperBegin), _mm_cmplt_epi8(block, upperEnd));
+            block = _mm_or_si128(block, _mm_and_si128(isUpper, caseBit));
+        }
+        _mm_storeu_si128((__m128i *)(out + i), block);
+    }
+#else
+    (void)simdBlock;
+#endif
+    for (; i < len; ++i) {
+        unsigned char c = (unsigned char)in[i];
+        if (c >= 128) {
+            return false;
+        }
+        out[i] = _asciiTable[c];
+    }
+    return true;
+}
+
 void Normalizer::normalizeUTF16(const uint16_t *in, size_t len,
                                 uint16_t *out)
 {
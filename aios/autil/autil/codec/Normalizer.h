@@ -43,6 +43,9 @@ public:
     void normalize(const std::string &word, std::string &normalizeWord);
     void normalizeUTF16(const uint16_t *in, size_t len,
                         uint16_t *out);
+    // normalize utf8 text byte by byte without utf16 convert, out should hold len bytes.
+    // return false when in has non ascii chars or ascii chars are normalized to non ascii ones.
+    bool normalizeASCII(const char *in, size_t len, char *out) const;
     bool needNormalize() {
         return !(_options.traditionalSensitive &&
                  _options.widthSensitive &&
@@ -66,9 +69,16 @@ private:
    bool stringConverter(const std::string &input, std::string &output, TO_UNICODE_FUN to_unicode,
                         FROM_UNICODE_FUN from_unicode, unsigned op = 0) const;
 
+private:
+    void initASCIITable();
+
 private:
     NormalizeOptions _options;
     NormalizeTable _table;
+    char _asciiTable[128];
+    bool _asciiClosed;
+    bool _asciiIdentity;
+    bool _asciiLowerCase;
 private:
     AUTIL_LOG_DECLARE();
 };
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "autil/metric/QueryLatencyRecorder.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace autil {
+namespace metric {
+
+QueryLatencyRecorder::QueryLatencyRecorder()
+{
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        _buckets[i].store(0, memory_order_relaxed);
+    }
+}
+
+QueryLatencyRecorder::~QueryLatencyRecorder() {}
+
+QueryLatencyRecorder* QueryLatencyRecorder::getInstance()
+{
+    static QueryLatencyRecorder recorder;
+    return &recorder;
+}
+
+void QueryLatencyRecorder::record(double latencyMs)
+{
+    _buckets[getBucketIdx(latencyMs)].fetch_add(1, memory_order_relaxed);
+}
+
+void QueryLatencyRecorder::snapshot(Snapshot& snapshot) const
+{
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        snapshot[i] = _buckets[i].load(memory_order_relaxed);
+    }
+}
+
+bool QueryLatencyRecorder::getQuantile(const Snapshot& begin, const Snapshot& end, double quantile,
+                                       uint64_t minSampleCount, double& latencyMs, uint64_t& sampleCount)
+{
+    sampleCount = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        sampleCount += end[i] - begin[i];
+    }
+    if (sampleCount == 0 || sampleCount < minSampleCount) {
+        return false;
+    }
+    uint64_t rank = (uint64_t)ceil(sampleCount * quantile);
+    uint64_t count = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        count += end[i] - begin[i];
+        if (count >= rank) {
+            latencyMs = getBucketUpperBound(i);
+            return true;
+        }
+    }
+    latencyMs = getBucketUpperBound(BUCKET_COUNT - 1);
+    return true;
+}
+
+size_t QueryLatencyRecorder::getBucketIdx(double latencyMs)
+{
+    if (!(latencyMs > MIN_LATENCY_MS)) {
+        return 0;
+    }
+    size_t idx = (size_t)ceil(log(latencyMs / MIN_LATENCY_MS) / log(BUCKET_RATIO));
+    return min(idx, BUCKET_COUNT - 1);
+}
+
+double QueryLatencyRecorder::getBucketUpperBound(size_t bucketIdx)
+{
+    return MIN_LATENCY_MS * pow(BUCKET_RATIO, (double)bucketIdx);
+}
+
+}
+}
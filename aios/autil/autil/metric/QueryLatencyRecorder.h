@@ -0,0 +1,67 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace autil {
+namespace metric {
+
+// process wide histogram of online query latency. searchers living in the
+// same process record every query, realtime builders read the quantiles of
+// the queries between two snapshots to decide how fast they may build.
+// it sits below both of them so neither depends on the other.
+class QueryLatencyRecorder
+{
+public:
+    static constexpr size_t BUCKET_COUNT = 64;
+    typedef std::array<uint64_t, BUCKET_COUNT> Snapshot;
+
+public:
+    QueryLatencyRecorder();
+    ~QueryLatencyRecorder();
+
+    QueryLatencyRecorder(const QueryLatencyRecorder&) = delete;
+    QueryLatencyRecorder& operator=(const QueryLatencyRecorder&) = delete;
+
+public:
+    static QueryLatencyRecorder* getInstance();
+
+public:
+    void record(double latencyMs);
+    void snapshot(Snapshot& snapshot) const;
+
+    // quantile of the latencies recorded between begin and end, return false
+    // when less than minSampleCount queries are recorded.
+    static bool getQuantile(const Snapshot& begin, const Snapshot& end, double quantile, uint64_t minSampleCount,
+                            double& latencyMs, uint64_t& sampleCount);
+
+private:
+    static size_t getBucketIdx(double latencyMs);
+    static double getBucketUpperBound(size_t bucketIdx);
+
+private:
+    static constexpr double MIN_LATENCY_MS = 0.1;
+    static constexpr double BUCKET_RATIO = 1.25;
+
+    std::atomic<uint64_t> _buckets[BUCKET_COUNT];
+};
+
+}
+}
@@ -16,6 +16,8 @@
 #ifndef ISEARCH_EXPRESSION_ATTRIBUTEEXPRESSIONTYPED_H
 #define ISEARCH_EXPRESSION_ATTRIBUTEEXPRESSIONTYPED_H
 
+#include <algorithm>
+
 #include "autil/Log.h"
 #include "expression/framework/AttributeExpression.h"
 #include "matchdoc/Reference.h"
@@ -67,6 +69,17 @@ public:
         return _ref->get(matchDoc);
     }
     
+    // gather values into contiguous array, used by columnar batch evaluate
+    void batchGetValue(const matchdoc::MatchDoc *matchDocs, uint32_t docCount, T *values) const {
+        if (unlikely(_ref == NULL)) {
+            std::fill(values, values + docCount, _value);
+            return;
+        }
+        for (uint32_t i = 0; i < docCount; i++) {
+            values[i] = _ref->get(matchDocs[i]);
+        }
+    }
+
     inline void storeValue(const matchdoc::MatchDoc &matchDoc, const T &value) {
         assert(_ref);
         _ref->set(matchDoc, value);
@@ -16,6 +16,9 @@
 #ifndef ISEARCH_EXPRESSION_BINARYATTRIBUTEEXPRESSION_H
 #define ISEARCH_EXPRESSION_BINARYATTRIBUTEEXPRESSION_H
 
+#include <algorithm>
+#include <type_traits>
+
 #include "expression/common.h"
 #include "expression/framework/AttributeExpressionTyped.h"
 #include "expression/framework/TypeInfo.h"
@@ -113,6 +116,11 @@ class BinaryAttributeExpression : public AttributeExpressionTyped<ResultType>
 public:
     typedef AttributeExpressionTyped<LeftArgType> LeftAttrExpr;
     typedef AttributeExpressionTyped<RightArgType> RightAttrExpr;
+    // arithmetic operands are evaluated column by column in blocks of BATCH_SIZE docs
+    static constexpr bool COLUMNAR_EVALUATE = std::is_arithmetic<LeftArgType>::value
+                                              && std::is_arithmetic<RightArgType>::value
+                                              && std::is_arithmetic<ResultType>::value;
+    static constexpr uint32_t BATCH_SIZE = 256;
 public:
     BinaryAttributeExpression(
             const std::string &exprStr,
@@ -139,9 +147,8 @@ public:
     }
 
     /* override */ void batchEvaluate(matchdoc::MatchDoc *matchDocs, uint32_t docCount) {
-        for (uint32_t i = 0; i < docCount; i++) {
-            innerEvaluate(matchDocs[i]);
-        }
+        innerBatchEvaluate(matchDocs, docCount,
+                           std::integral_constant<bool, COLUMNAR_EVALUATE>());
     }
 
     /* override */ matchdoc::ReferenceBase* getReferenceBase() const {
@@ -155,6 +162,30 @@ private:
         this->storeValue(matchDoc, result);
     }
 
+    void innerBatchEvaluate(matchdoc::MatchDoc *matchDocs, uint32_t docCount, std::false_type) {
+        for (uint32_t i = 0; i < docCount; i++) {
+            innerEvaluate(matchDocs[i]);
+        }
+    }
+
+    void innerBatchEvaluate(matchdoc::MatchDoc *matchDocs, uint32_t docCount, std::true_type) {
+        LeftArgType lefts[BATCH_SIZE];
+        RightArgType rights[BATCH_SIZE];
+        ResultType results[BATCH_SIZE];
+        for (uint32_t begin = 0; begin < docCount; begin += BATCH_SIZE) {
+            uint32_t count = std::min(BATCH_SIZE, docCount - begin);
+            _leftExpr->batchGetValue(matchDocs + begin, count, lefts);
+            _rightExpr->batchGetValue(matchDocs + begin, count, rights);
+            // no virtual call and no matchdoc access here, compiler can vectorize it
+            for (uint32_t i = 0; i < count; i++) {
+                results[i] = _binaryOperator(lefts[i], rights[i]);
+            }
+            for (uint32_t i = 0; i < count; i++) {
+                this->storeValue(matchDocs[begin + i], results[i]);
+            }
+        }
+    }
+
 private:
     LeftAttrExpr *_leftExpr;
     RightAttrExpr *_rightExpr;
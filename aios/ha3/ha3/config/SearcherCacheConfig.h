@@ -36,6 +36,11 @@ public:
         latencyLimitInMs = 0.0; // ms
         minAllowedCacheDocNum = 0;
         maxAllowedCacheDocNum = std::numeric_limits<uint32_t>::max();
+        incRefreshEnable = false;
+        postingCacheSize = 0; //MB
+        postingCacheAdmitCount = 2;
+        postingCacheMinDocFreq = 10000;
+        postingCacheMaxDocFreq = 1000000;
     }
     ~SearcherCacheConfig() {};
 public:
@@ -47,6 +52,11 @@ public:
         JSONIZE(json, "latency_limit", latencyLimitInMs);
         JSONIZE(json, "min_allowed_cache_doc_num", minAllowedCacheDocNum);
         JSONIZE(json, "max_allowed_cache_doc_num", maxAllowedCacheDocNum);
+        JSONIZE(json, "inc_refresh_enable", incRefreshEnable);
+        JSONIZE(json, "posting_cache_size", postingCacheSize);
+        JSONIZE(json, "posting_cache_admit_count", postingCacheAdmitCount);
+        JSONIZE(json, "posting_cache_min_doc_freq", postingCacheMinDocFreq);
+        JSONIZE(json, "posting_cache_max_doc_freq", postingCacheMaxDocFreq);
     }
 public:
     uint32_t maxItemNum;
@@ -56,6 +66,14 @@ public:
     float latencyLimitInMs;
     uint32_t minAllowedCacheDocNum;
     uint32_t maxAllowedCacheDocNum;
+    bool incRefreshEnable; // write merged result back on cache hit
+    // docids of hot terms in built segments, shared by all queries.
+    // not for tables with updatable inverted index.
+    uint32_t postingCacheSize;
+    uint32_t postingCacheAdmitCount;
+    uint32_t postingCacheMinDocFreq;
+    // a miss of an admitted term scans its posting in the query, bound the scan
+    uint32_t postingCacheMaxDocFreq;
 private:
     AUTIL_LOG_DECLARE();
 };
@@ -140,6 +140,10 @@ bool QrsBizMetrics::init(kmonitor::MetricsGroupManager *manager) {
     REGISTER_GAUGE_MUTABLE_METRIC(_sqlResultSize, "sql.resultSize");
     REGISTER_GAUGE_MUTABLE_METRIC(_sqlRowCount, "sql.rowCount");
     REGISTER_GAUGE_MUTABLE_METRIC(_sqlCacheKeyCount, "sql.cacheKeyCount");
+    REGISTER_QPS_MUTABLE_METRIC(_sqlResultCacheHitQps, "sql.resultCacheHitQps");
+    REGISTER_QPS_MUTABLE_METRIC(_sqlResultCacheMissQps, "sql.resultCacheMissQps");
+    REGISTER_GAUGE_MUTABLE_METRIC(_sqlResultCacheMemUse, "sql.resultCacheMemUse");
+    REGISTER_GAUGE_MUTABLE_METRIC(_sqlResultCacheItemCount, "sql.resultCacheItemCount");
     REGISTER_GAUGE_MUTABLE_METRIC(_sqlOrginalRequestSize, "sql.orginalRequestSize");
     REGISTER_LATENCY_MUTABLE_METRIC(_sqlResultCompressLatency, "sql.resultCompressLatency");
     return true;
@@ -189,6 +193,18 @@ void QrsBizMetrics::reportSqlMetric(const kmonitor::MetricsTags *tags,
     if (collector->isIncreaseSqlSoftFailureQps()) {
         REPORT_MUTABLE_QPS(_sqlSoftFailureQps);
     }
+    if (collector->isIncreaseSqlResultCacheHitQps()) {
+        REPORT_MUTABLE_QPS(_sqlResultCacheHitQps);
+    }
+    if (collector->isIncreaseSqlResultCacheMissQps()) {
+        REPORT_MUTABLE_QPS(_sqlResultCacheMissQps);
+    }
+    if (collector->isIncreaseSqlResultCacheHitQps()
+        || collector->isIncreaseSqlResultCacheMissQps()) {
+        HA3_REPORT_MUTABLE_METRIC(_sqlResultCacheMemUse, collector->getSqlResultCacheMemUse());
+        HA3_REPORT_MUTABLE_METRIC(_sqlResultCacheItemCount,
+                                  collector->getSqlResultCacheItemCount());
+    }
     if (collector->getIsCompress()) {
         HA3_REPORT_MUTABLE_METRIC(_sqlResultCompressLatency, collector->getResultCompressLatency());
     }
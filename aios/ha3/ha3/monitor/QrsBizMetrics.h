@@ -140,6 +140,10 @@ private:
     kmonitor::MutableMetric *_sqlResultSize = nullptr;
     kmonitor::MutableMetric *_sqlRowCount = nullptr;
     kmonitor::MutableMetric *_sqlCacheKeyCount = nullptr;
+    kmonitor::MutableMetric *_sqlResultCacheHitQps = nullptr;
+    kmonitor::MutableMetric *_sqlResultCacheMissQps = nullptr;
+    kmonitor::MutableMetric *_sqlResultCacheMemUse = nullptr;
+    kmonitor::MutableMetric *_sqlResultCacheItemCount = nullptr;
     kmonitor::MutableMetric *_sqlOrginalRequestSize = nullptr;
     kmonitor::MutableMetric *_sqlResultCompressLatency = nullptr;
 private:
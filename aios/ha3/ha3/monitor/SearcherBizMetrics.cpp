@@ -19,6 +19,7 @@
 #include <iosfwd>
 
 #include "alog/Logger.h"
+#include "autil/metric/QueryLatencyRecorder.h"
 #include "ha3/common/Tracer.h"
 #include "ha3/isearch.h"
 #include "ha3/monitor/Ha3BizMetrics.h"
@@ -97,6 +98,11 @@ bool SearcherBizMetrics::init(kmonitor::MetricsGroupManager *manager) {
     REGISTER_QPS_MUTABLE_METRIC(_missByExpireNum ,"phase1.cache.missByExpireNum");
     REGISTER_QPS_MUTABLE_METRIC(_missByTruncateNum ,"phase1.cache.missByTruncateNum");
 
+    REGISTER_GAUGE_MUTABLE_METRIC(_postingCacheHitCount ,"phase1.cache.postingCacheHitCount");
+    REGISTER_GAUGE_MUTABLE_METRIC(_postingCacheMissCount ,"phase1.cache.postingCacheMissCount");
+    REGISTER_GAUGE_MUTABLE_METRIC(_postingCacheHitRatio ,"phase1.cache.postingCacheHitRatio");
+    REGISTER_GAUGE_MUTABLE_METRIC(_postingCacheMemUse ,"phase1.cache.postingCacheMemUse");
+
     // phase2
     REGISTER_QPS_MUTABLE_METRIC(_emptyQpsPhase2 ,"phase2.emptyQps");
     REGISTER_GAUGE_MUTABLE_METRIC(_innerResultSizePhase2 ,"phase2.resultSize");
@@ -126,7 +132,11 @@ void SearcherBizMetrics::report(const kmonitor::MetricsTags *tags, SessionMetric
 
 void SearcherBizMetrics::reportPhase1(const kmonitor::MetricsTags *tags, SessionMetricsCollector *collector) {
     // latency
-    HA3_REPORT_MUTABLE_METRIC(_sessionLatencyPhase1, collector->getSessionLatency());
+    double sessionLatency = collector->getSessionLatency();
+    // realtime builders in this process throttle themselves by the query latency,
+    // sql searches record theirs in navi RunGraphMetrics
+    autil::metric::QueryLatencyRecorder::getInstance()->record(sessionLatency);
+    HA3_REPORT_MUTABLE_METRIC(_sessionLatencyPhase1, sessionLatency);
     HA3_REPORT_MUTABLE_METRIC(_searcherProcessLatencyPhase1, collector->getProcessLatency());
     HA3_REPORT_MUTABLE_METRIC(_beforeSearchLatency, collector->getBeforeSearchLatency());
     HA3_REPORT_MUTABLE_METRIC(_rankLatency, collector->getRankLatency());
@@ -206,6 +216,20 @@ void SearcherBizMetrics::reportPhase1(const kmonitor::MetricsTags *tags, Session
     if (collector->isMissByTruncate()) {
         REPORT_MUTABLE_QPS(_missByTruncateNum);
     }
+    int32_t postingCacheHitCount = collector->getPostingCacheHitCount();
+    int32_t postingCacheMissCount = collector->getPostingCacheMissCount();
+    if (postingCacheHitCount >= 0 && postingCacheMissCount >= 0) {
+        HA3_REPORT_MUTABLE_METRIC(_postingCacheHitCount, postingCacheHitCount);
+        HA3_REPORT_MUTABLE_METRIC(_postingCacheMissCount, postingCacheMissCount);
+        int32_t postingCacheLookupCount = postingCacheHitCount + postingCacheMissCount;
+        if (postingCacheLookupCount > 0) {
+            HA3_REPORT_MUTABLE_METRIC(_postingCacheHitRatio,
+                    100.0 * postingCacheHitCount / postingCacheLookupCount);
+        }
+    }
+    if (collector->getPostingCacheMemUse() >= 0) {
+        HA3_REPORT_MUTABLE_METRIC(_postingCacheMemUse, collector->getPostingCacheMemUse());
+    }
 }
 
 void SearcherBizMetrics::reportPhase2(const kmonitor::MetricsTags *tags, SessionMetricsCollector *collector) {
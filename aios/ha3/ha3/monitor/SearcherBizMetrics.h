@@ -98,6 +98,11 @@ private:
     kmonitor::MutableMetric *_missByDelTooMuchNum = nullptr;
     kmonitor::MutableMetric *_missByTruncateNum = nullptr;
 
+    kmonitor::MutableMetric *_postingCacheHitCount = nullptr;
+    kmonitor::MutableMetric *_postingCacheMissCount = nullptr;
+    kmonitor::MutableMetric *_postingCacheHitRatio = nullptr;
+    kmonitor::MutableMetric *_postingCacheMemUse = nullptr;
+
     // truncate related
     kmonitor::MutableMetric *_useTruncateOptimizerNum = nullptr;
 private:
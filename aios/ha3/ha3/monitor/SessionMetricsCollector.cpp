@@ -117,6 +117,9 @@ SessionMetricsCollector::SessionMetricsCollector(Tracer* tracer) {
     _missByExpire = false;
     _missByDelTooMuch = false;
     _missByTruncate = false;
+    _postingCacheHitCount = -1;
+    _postingCacheMissCount = -1;
+    _postingCacheMemUse = -1;
     _useTruncateOptimizer = false;
     _originalPhase1RequestSize = 0;
     _originalPhase2RequestSize = 0;
@@ -140,6 +143,8 @@ SessionMetricsCollector::SessionMetricsCollector(Tracer* tracer) {
     _increaseSqlRunGraphErrorQps = false;
     _increaseSqlEmptyQps = false;
     _increaseSqlSoftFailureQps = false;
+    _increaseSqlResultCacheHitQps = false;
+    _increaseSqlResultCacheMissQps = false;
     _sqlPlanTime = 0;
     _sqlPlan2GraphTime = 0;
     _sqlRunGraphTime = 0;
@@ -148,6 +153,8 @@ SessionMetricsCollector::SessionMetricsCollector(Tracer* tracer) {
     _sqlPlanSize = 0;
     _sqlResultSize = 0;
     _sqlRowCount = 0;
+    _sqlResultCacheMemUse = 0;
+    _sqlResultCacheItemCount = 0;
     _sqlOrginalRequestSize = 0;
 }
 
@@ -115,6 +115,10 @@ public:
     void increaseMissByExpireNum() {_missByExpire = true;}
     void increaseMissByDelTooMuchNum() {_missByDelTooMuch = true;}
     void increaseMissByTruncateNum() {_missByTruncate = true;}
+    // posting result cache
+    void setPostingCacheHitCount(uint32_t count) {_postingCacheHitCount = count;}
+    void setPostingCacheMissCount(uint32_t count) {_postingCacheMissCount = count;}
+    void setPostingCacheMemUse(int64_t memUse) {_postingCacheMemUse = memUse;}
     // truncate related
     void increaseUseTruncateOptimizerNum() { _useTruncateOptimizer = true; }
 
@@ -207,6 +211,8 @@ public:
     void increaseSqlSoftFailureQps() {
         _increaseSqlSoftFailureQps = true;
     }
+    void increaseSqlResultCacheHitQps() { _increaseSqlResultCacheHitQps = true; }
+    void increaseSqlResultCacheMissQps() { _increaseSqlResultCacheMissQps = true; }
     void sqlRunGraphEndTrigger();
     void sqlFormatEndTrigger();
     void setSqlPlanTime(int64_t sqlPlanTime) {
@@ -222,6 +228,8 @@ public:
     void setSqlResultSize(int32_t size) { _sqlResultSize = size; }
     void setSqlRowCount(int32_t size) { _sqlRowCount = size; }
     void setSqlCacheKeyCount(uint64_t size) { _sqlCacheKeyCount = size; }
+    void setSqlResultCacheMemUse(uint64_t size) { _sqlResultCacheMemUse = size; }
+    void setSqlResultCacheItemCount(uint64_t count) { _sqlResultCacheItemCount = count; }
     void setSqlOrginalRequestSize(uint32_t size) { _sqlOrginalRequestSize = size; }
     uint32_t getSqlOrginalRequestSize() const { return _sqlOrginalRequestSize; }
 
@@ -298,6 +306,10 @@ public:
     bool isMissByExpire() const {return _missByExpire;}
     bool isMissByDelTooMuch() const {return _missByDelTooMuch;}
     bool isMissByTruncate() const {return _missByTruncate;}
+    // posting result cache
+    int32_t getPostingCacheHitCount() const {return _postingCacheHitCount;}
+    int32_t getPostingCacheMissCount() const {return _postingCacheMissCount;}
+    int64_t getPostingCacheMemUse() const {return _postingCacheMemUse;}
 
     bool useTruncateOptimizer() const { return _useTruncateOptimizer; }
 
@@ -367,6 +379,8 @@ public:
     bool isIncreaseSqlSoftFailureQps() const {
         return _increaseSqlSoftFailureQps;
     }
+    bool isIncreaseSqlResultCacheHitQps() const { return _increaseSqlResultCacheHitQps; }
+    bool isIncreaseSqlResultCacheMissQps() const { return _increaseSqlResultCacheMissQps; }
     int64_t getSqlPlanTime();
     int64_t getSqlPlan2GraphTime();
     int64_t getSqlRunGraphTime();
@@ -375,6 +389,8 @@ public:
     int32_t getSqlResultSize() { return _sqlResultSize; }
     int32_t getSqlRowCount() { return _sqlRowCount; }
     uint64_t getSqlCacheKeyCount() { return _sqlCacheKeyCount; }
+    uint64_t getSqlResultCacheMemUse() { return _sqlResultCacheMemUse; }
+    uint64_t getSqlResultCacheItemCount() { return _sqlResultCacheItemCount; }
     int64_t getSqlFormatEnd() { return _sqlFormatEnd; }
 
     double calculateLatency(int64_t start, int64_t end) const;
@@ -468,6 +484,10 @@ private:
     bool _missByExpire;
     bool _missByDelTooMuch;
     bool _missByTruncate;
+    // posting result cache
+    int32_t _postingCacheHitCount;
+    int32_t _postingCacheMissCount;
+    int64_t _postingCacheMemUse;
 
     bool _useTruncateOptimizer;
 
@@ -524,6 +544,8 @@ private:
     bool _increaseSqlRunGraphErrorQps;
     bool _increaseSqlEmptyQps;
     bool _increaseSqlSoftFailureQps;
+    bool _increaseSqlResultCacheHitQps;
+    bool _increaseSqlResultCacheMissQps;
     int64_t _sqlPlanTime;
     int64_t _sqlPlan2GraphTime;
     int64_t _sqlRunGraphTime;
@@ -533,6 +555,8 @@ private:
     int32_t _sqlResultSize;
     int32_t _sqlRowCount;
     uint64_t _sqlCacheKeyCount;
+    uint64_t _sqlResultCacheMemUse;
+    uint64_t _sqlResultCacheItemCount;
     uint32_t _sqlOrginalRequestSize;
 
     // other
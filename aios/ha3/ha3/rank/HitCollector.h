@@ -67,6 +67,9 @@ public:
         return _cmp;
     }
 protected:
+    bool isFull() const override {
+        return _queue->isFull();
+    }
     matchdoc::MatchDoc collectOneDoc(matchdoc::MatchDoc matchDoc) override;
     void doQuickInit(matchdoc::MatchDoc *matchDocs, uint32_t count) override;
     void doStealAllMatchDocs(autil::mem_pool::PoolVector<matchdoc::MatchDoc> &target) override;
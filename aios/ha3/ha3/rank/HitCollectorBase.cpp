@@ -57,6 +57,10 @@ HitCollectorBase::HitCollectorBase(AttributeExpression *expr,
     , _unscoredMatchDocCount(0)
     , _maxUnscoredMatchDocCount(0)
     , _unscoredMatchDocs(NULL)
+    , _upperBoundExpr(NULL)
+    , _upperBoundEvaluator(NULL)
+    , _thresholdScoreRef(NULL)
+    , _prunedDocCount(0)
 {
 }
 
@@ -218,6 +222,9 @@ void HitCollectorBase::collectOneMatchDoc(matchdoc::MatchDoc matchDoc) {
         _lazyScore = false;
     }
 
+    if (_upperBoundExpr && pruneByUpperBound(matchDoc)) {
+        return;
+    }
     if (!_batchScore) {
         evaluateMatchDoc(matchDoc);
     }
@@ -227,6 +234,32 @@ void HitCollectorBase::collectOneMatchDoc(matchdoc::MatchDoc matchDoc) {
     }
 }
 
+bool HitCollectorBase::getScoreThreshold(score_t &threshold) const {
+    if (!_thresholdScoreRef || _lazyScore || !isFull()) {
+        return false;
+    }
+    matchdoc::MatchDoc worstMatchDoc = top();
+    if (matchdoc::INVALID_MATCHDOC == worstMatchDoc) {
+        return false;
+    }
+    threshold = _thresholdScoreRef->get(worstMatchDoc);
+    return true;
+}
+
+bool HitCollectorBase::pruneByUpperBound(matchdoc::MatchDoc matchDoc) {
+    score_t threshold;
+    if (!getScoreThreshold(threshold)) {
+        return false;
+    }
+    // equal score may still win by doc info, only strictly lower bound is safe to skip
+    if (_upperBoundEvaluator(_upperBoundExpr, matchDoc) < threshold) {
+        _matchDocAllocatorPtr->deallocate(matchDoc);
+        ++_prunedDocCount;
+        return true;
+    }
+    return false;
+}
+
 void HitCollectorBase::flattenCollectMatchDoc(matchdoc::MatchDoc matchDoc) {
     auto accessor = _matchDocAllocatorPtr->getSubDocAccessor();
     auto processor = std::bind(&HitCollectorBase::collectDoc,
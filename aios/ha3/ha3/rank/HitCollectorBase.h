@@ -22,7 +22,9 @@
 #include "autil/CommonMacros.h"
 #include "autil/Log.h" // IWYU pragma: keep
 #include "ha3/common/Ha3MatchDocAllocator.h"
+#include "ha3/isearch.h"
 #include "matchdoc/MatchDoc.h"
+#include "matchdoc/Reference.h"
 #include "suez/turing/expression/framework/AttributeExpression.h"
 
 namespace autil {
@@ -109,6 +111,36 @@ public:
     uint32_t getDeletedDocCount() const {
         return _deletedDocCount;
     }
+    /*
+     * skip scoring docs whose upper bound is lower than current threshold.
+     * upperBoundExpr must never be less than the score in scoreRef,
+     * and scoreRef must be the first rank sort key in descending order.
+     */
+    typedef score_t (*ScoreUpperBoundEvaluator)(suez::turing::AttributeExpression *expr,
+                                                matchdoc::MatchDoc matchDoc);
+    template <typename T>
+    static score_t evaluateScoreUpperBound(suez::turing::AttributeExpression *expr,
+                                           matchdoc::MatchDoc matchDoc)
+    {
+        auto typedExpr = static_cast<suez::turing::AttributeExpressionTyped<T> *>(expr);
+        return (score_t)typedExpr->evaluateAndReturn(matchDoc);
+    }
+    void setScoreUpperBound(suez::turing::AttributeExpression *upperBoundExpr,
+                            ScoreUpperBoundEvaluator upperBoundEvaluator,
+                            const matchdoc::Reference<score_t> *scoreRef)
+    {
+        _upperBoundExpr = upperBoundExpr;
+        _upperBoundEvaluator = upperBoundEvaluator;
+        _thresholdScoreRef = scoreRef;
+    }
+    /*
+     * score of the worst doc when collector is full,
+     * docs with lower score can not be collected any more.
+     */
+    bool getScoreThreshold(score_t &threshold) const;
+    uint32_t getPrunedDocCount() const {
+        return _prunedDocCount;
+    }
     uint32_t stealCollectCount() {
         uint32_t collectCount = _collectCount;
         _collectCount = 0;
@@ -129,6 +161,7 @@ public:
     // for case
     autil::mem_pool::Pool *getPool() { return _pool; }
 protected:
+    virtual bool isFull() const { return false; }
     virtual void doQuickInit(matchdoc::MatchDoc *matchDocBuffer, uint32_t count);
     virtual void doUpdateExprEvaluatedStatus();
 protected:
@@ -144,6 +177,7 @@ private:
     void collectOneMatchDoc(matchdoc::MatchDoc matchDoc);
     void flattenCollectMatchDoc(matchdoc::MatchDoc matchDoc);
     void collectDoc(matchdoc::MatchDoc matchDoc);
+    bool pruneByUpperBound(matchdoc::MatchDoc matchDoc);
 protected:
     suez::turing::AttributeExpression *_expr;
     autil::mem_pool::Pool *_pool;
@@ -159,6 +193,10 @@ private:
     uint32_t _unscoredMatchDocCount;
     uint32_t _maxUnscoredMatchDocCount;
     matchdoc::MatchDoc *_unscoredMatchDocs;
+    suez::turing::AttributeExpression *_upperBoundExpr;
+    ScoreUpperBoundEvaluator _upperBoundEvaluator;
+    const matchdoc::Reference<score_t> *_thresholdScoreRef;
+    uint32_t _prunedDocCount;
 private:
     AUTIL_LOG_DECLARE();
 };
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <iosfwd>
 #include <memory>
+#include <utility>
 
 #include "autil/Log.h"
 #include "autil/mem_pool/Pool.h"
@@ -59,11 +60,20 @@ NthElementCollector::NthElementCollector(uint32_t size,
     , _matchDocCount(0)
     , _minMatchDoc(matchdoc::INVALID_MATCHDOC)
     , _cmp(cmp)
+    , _keyNthElement(NULL)
+    , _keyItemSize(0)
+    , _keyBuffer(NULL)
+    , _orderedBuffer(NULL)
 {
     addExtraDocIdentifierCmp(_cmp);
+    initKeyNthElement();
     // need BATCH_EVALUATE_SCORE_SIZE more buffer to replace memory
-    _matchDocBuffer = (matchdoc::MatchDoc *)pool->allocate(
-            (_maxBufferSize + BATCH_EVALUATE_SCORE_SIZE) * sizeof(matchdoc::MatchDoc));
+    uint32_t bufferSize = _maxBufferSize + BATCH_EVALUATE_SCORE_SIZE;
+    _matchDocBuffer = (matchdoc::MatchDoc *)pool->allocate(bufferSize * sizeof(matchdoc::MatchDoc));
+    if (_keyNthElement) {
+        _keyBuffer = pool->allocate(bufferSize * _keyItemSize);
+        _orderedBuffer = (matchdoc::MatchDoc *)pool->allocate(bufferSize * sizeof(matchdoc::MatchDoc));
+    }
 }
 
 NthElementCollector::~NthElementCollector() {
@@ -71,7 +81,12 @@ NthElementCollector::~NthElementCollector() {
         _matchDocAllocatorPtr->deallocate(_matchDocBuffer[i]);
     }
     POOL_DELETE_CLASS(_cmp);
-    _pool->deallocate(_matchDocBuffer, (_maxBufferSize + BATCH_EVALUATE_SCORE_SIZE) * sizeof(matchdoc::MatchDoc));
+    uint32_t bufferSize = _maxBufferSize + BATCH_EVALUATE_SCORE_SIZE;
+    _pool->deallocate(_matchDocBuffer, bufferSize * sizeof(matchdoc::MatchDoc));
+    if (_keyNthElement) {
+        _pool->deallocate(_keyBuffer, bufferSize * _keyItemSize);
+        _pool->deallocate(_orderedBuffer, bufferSize * sizeof(matchdoc::MatchDoc));
+    }
 }
 
 void NthElementCollector::doQuickInit(matchdoc::MatchDoc *matchDocs, uint32_t count) {
@@ -141,7 +156,61 @@ uint32_t NthElementCollector::collectAndReplace(matchdoc::MatchDoc *matchDocs,
     return replacedMatchDocCount;
 }
 
+void NthElementCollector::initKeyNthElement() {
+#define INIT_KEY_NTH_ELEMENT_HELPER(T)                                  \
+    if (!_keyNthElement && dynamic_cast<OneRefComparatorTyped<T> *>(_cmp)) { \
+        _keyNthElement = &NthElementCollector::doKeyNthElement<T>;      \
+        _keyItemSize = sizeof(std::pair<T, uint32_t>);                  \
+    }
+    INIT_KEY_NTH_ELEMENT_HELPER(int8_t);
+    INIT_KEY_NTH_ELEMENT_HELPER(uint8_t);
+    INIT_KEY_NTH_ELEMENT_HELPER(int16_t);
+    INIT_KEY_NTH_ELEMENT_HELPER(uint16_t);
+    INIT_KEY_NTH_ELEMENT_HELPER(int32_t);
+    INIT_KEY_NTH_ELEMENT_HELPER(uint32_t);
+    INIT_KEY_NTH_ELEMENT_HELPER(int64_t);
+    INIT_KEY_NTH_ELEMENT_HELPER(uint64_t);
+    INIT_KEY_NTH_ELEMENT_HELPER(float);
+    INIT_KEY_NTH_ELEMENT_HELPER(double);
+#undef INIT_KEY_NTH_ELEMENT_HELPER
+}
+
+template <typename T>
+void NthElementCollector::doKeyNthElement() {
+    auto cmp = static_cast<OneRefComparatorTyped<T> *>(_cmp);
+    const matchdoc::Reference<T> *ref = cmp->getReference();
+    bool sortFlag = cmp->getSortFlag();
+    typedef std::pair<T, uint32_t> KeyItem;
+    assert(_keyItemSize == sizeof(KeyItem));
+    KeyItem *keys = (KeyItem *)_keyBuffer;
+    for (uint32_t i = 0; i < _matchDocCount; ++i) {
+        new (keys + i) KeyItem(ref->get(_matchDocBuffer[i]), i);
+    }
+    matchdoc::MatchDoc *matchDocs = _matchDocBuffer;
+    const ComboComparator *comboCmp = _cmp;
+    // better key first, equal keys fall back to doc info in comparator
+    auto betterThan = [sortFlag, matchDocs, comboCmp](const KeyItem &a, const KeyItem &b) {
+        if (a.first < b.first) {
+            return sortFlag;
+        } else if (b.first < a.first) {
+            return !sortFlag;
+        }
+        return comboCmp->compare(matchDocs[b.second], matchDocs[a.second]);
+    };
+    nth_element(keys, keys + _size - 1, keys + _matchDocCount, betterThan);
+    for (uint32_t i = 0; i < _matchDocCount; ++i) {
+        _orderedBuffer[i] = _matchDocBuffer[keys[i].second];
+    }
+    // both buffers have the same size, the reordered one becomes the match doc buffer
+    std::swap(_matchDocBuffer, _orderedBuffer);
+    _minMatchDoc = _matchDocBuffer[_size - 1];
+}
+
 void NthElementCollector::doNthElement() {
+    if (_keyNthElement) {
+        (this->*_keyNthElement)();
+        return;
+    }
     MatchDocComp comp(_cmp);
     nth_element(_matchDocBuffer, // start 
                 _matchDocBuffer + _size - 1, // mid
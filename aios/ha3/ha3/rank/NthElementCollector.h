@@ -68,6 +68,9 @@ public:
         return _cmp;
     }
 protected:
+    bool isFull() const override {
+        return matchdoc::INVALID_MATCHDOC != _minMatchDoc && _matchDocCount >= _size;
+    }
     uint32_t collectAndReplace(matchdoc::MatchDoc *matchDocs,
             uint32_t count, matchdoc::MatchDoc *&retDocs) override;
     void doQuickInit(matchdoc::MatchDoc *matchDocs, uint32_t count) override;
@@ -79,6 +82,9 @@ protected:
     matchdoc::MatchDoc findMinMatchDoc(matchdoc::MatchDoc *matchDocs, uint32_t count);
 private:
     void doNthElement();
+    template <typename T>
+    void doKeyNthElement();
+    void initKeyNthElement();
 protected:
     uint32_t _size;
     uint32_t _maxBufferSize;
@@ -86,6 +92,12 @@ protected:
     matchdoc::MatchDoc *_matchDocBuffer;
     matchdoc::MatchDoc _minMatchDoc;
     ComboComparator *_cmp;
+    // select on contiguous sort keys when comparator is one numeric reference
+    void (NthElementCollector::*_keyNthElement)();
+    // pool buffers of key nth element, reused by every call
+    size_t _keyItemSize;
+    void *_keyBuffer;
+    matchdoc::MatchDoc *_orderedBuffer;
 private:
     friend class NthElementCollectorTest;
 private:
@@ -86,6 +86,12 @@ public:
         }
         return compareDocInfo(a, b);
     }
+    const matchdoc::Reference<T> *getReference() const {
+        return _reference;
+    }
+    bool getSortFlag() const {
+        return _sortFlag;
+    }
 private:
     inline bool compareRef(T& a, T& b) const {
         return _sortFlag ? b < a : a < b;
@@ -40,6 +40,7 @@
 #include "ha3/monitor/SessionMetricsCollector.h"
 #include "ha3/proxy/Merger.h"
 #include "ha3/search/CacheMinScoreFilter.h"
+#include "ha3/search/CacheMissSearchStrategy.h"
 #include "ha3/search/CacheResult.h"
 #include "ha3/search/DocCountLimits.h"
 #include "ha3/search/HitCollectorManager.h"
@@ -126,6 +127,8 @@ void CacheHitSearchStrategy::afterStealFromCollector(InnerSearchResult& innerRes
         uint64_t key = cacheClause->getKey();
         PartitionRange partRange = cacheClause->getPartRange();
         searcherCache->deleteCacheItem(key, partRange);
+    } else {
+        _needRefresh = searcherCache->incRefreshEnabled();
     }
 
     if (innerResult.matchDocVec.size() > 0) {
@@ -139,13 +142,58 @@ void CacheHitSearchStrategy::afterStealFromCollector(InnerSearchResult& innerRes
                 rankCollector, allFirstExpressions, innerResult.matchDocVec,
                 expectCount);
     }
+    _incTruncated = innerResult.actualMatchDocs > innerResult.matchDocVec.size();
 }
 
 common::Result *CacheHitSearchStrategy::reconstructResult(common::Result *result) {
     CacheResult *cacheResult = _cacheManager->getCacheResult();
     refreshAttributes(cacheResult->getResult());
-    return mergeResult(cacheResult->stealResult(),
-                       result, _request, _docCountLimits.requiredTopK);
+    common::Result *mergedResult = mergeResult(cacheResult->stealResult(),
+            result, _request, _docCountLimits.requiredTopK);
+    if (_needRefresh) {
+        refreshCacheItem(cacheResult, mergedResult);
+    }
+    return mergedResult;
+}
+
+void CacheHitSearchStrategy::refreshCacheItem(const CacheResult *cacheResult,
+        common::Result *mergedResult)
+{
+    // the merged result covers all docs up to the current partition info,
+    // writing it back moves the item watermark forward so that later hits
+    // only seek docs built after this query.
+    MatchDocs *matchDocs = mergedResult->getMatchDocs();
+    if (mergedResult->hasError() || !matchDocs) {
+        return;
+    }
+    // merger may cut the result to the request topK, never shrink the item
+    if (matchDocs->size() < _cacheManager->getCachedDocCount()) {
+        return;
+    }
+    CacheResult *refreshedResult = CacheMissSearchStrategy::constructCacheResult(
+            mergedResult, cacheResult->getHeader()->minScoreFilter,
+            _cacheManager->getIndexPartReaderWrapper());
+    *refreshedResult->getHeader() = *cacheResult->getHeader();
+    refreshedResult->setTruncated(cacheResult->isTruncated() || _incTruncated);
+    refreshedResult->setUseTruncateOptimizer(cacheResult->useTruncateOptimizer());
+
+    SearcherCacheClause *cacheClause = _request->getSearcherCacheClause();
+    assert(cacheClause);
+    auto searcherCache = _cacheManager->getSearcherCache();
+    if (searcherCache->refresh(cacheClause->getKey(), cacheClause->getPartRange(),
+                               refreshedResult, _request->getPool()))
+    {
+        SessionMetricsCollector *collector = _cacheManager->getMetricsCollector();
+        collector->increaseCachePutNum();
+        uint64_t memUse;
+        uint32_t itemNum;
+        searcherCache->getCacheStat(memUse, itemNum);
+        collector->setCacheMemUse(memUse);
+        collector->setCacheItemNum(itemNum);
+    }
+    // merged result is owned by the caller
+    refreshedResult->stealResult();
+    delete refreshedResult;
 }
 
 void CacheHitSearchStrategy::refreshAttributes(common::Result *result) {
@@ -92,6 +92,7 @@ private:
                                 const common::Request *request,
                                 uint32_t requireTopK);
     void refreshAttributes(common::Result *result);
+    void refreshCacheItem(const CacheResult *cacheResult, common::Result *mergedResult);
     void initRefreshAttrs(const common::Ha3MatchDocAllocatorPtr& vsa,
                           suez::turing::JoinDocIdConverterCreator *docIdConverterFactory,
                           suez::turing::AttributeExpressionFactory *attrExprFactory,
@@ -110,6 +111,8 @@ private:
     autil::mem_pool::Pool *_pool = nullptr;
     std::string _mainTable;
     indexlib::partition::PartitionReaderSnapshot *_partitionReaderSnapshot = nullptr;
+    bool _needRefresh = false;
+    bool _incTruncated = false;
 private:
     friend class CacheHitSearchStrategyTest;
 private:
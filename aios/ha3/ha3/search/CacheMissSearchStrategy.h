@@ -73,10 +73,11 @@ public:
         }
         return _docCountLimits.requiredTopK;
     }
-private:
+public:
     static CacheResult* constructCacheResult(common::Result *result,
             const CacheMinScoreFilter &minScoreFilter,
             const IndexPartitionReaderWrapperPtr& idxPartReaderWrapper);
+private:
     static void fillGids(const common::Result *result,
                          const std::shared_ptr<PartitionInfoWrapper> &partInfoPtr,
                          std::vector<globalid_t> &gids);
@@ -49,6 +49,9 @@
 #include "suez/turing/expression/framework/AttributeExpression.h"
 #include "suez/turing/expression/framework/AttributeExpressionCreatorBase.h"
 #include "suez/turing/expression/framework/ComboAttributeExpression.h"
+#include "suez/turing/expression/framework/VariableTypeTraits.h"
+#include "suez/turing/expression/syntax/SyntaxExpr.h"
+#include "suez/turing/expression/syntax/SyntaxParser.h"
 
 using namespace std;
 using namespace suez::turing;
@@ -60,6 +63,9 @@ namespace isearch {
 namespace search {
 AUTIL_LOG_SETUP(ha3, HitCollectorManager);
 
+// kvpair declaring an expression never less than rank score, e.g. "static_score * 2.0"
+static const std::string RANK_SCORE_UPPER_BOUND = "rank_score_upper_bound";
+
 HitCollectorManager::HitCollectorManager(
         AttributeExpressionCreatorBase *attrExprCreator,
         SortExpressionCreator *sortExpressionCreator,
@@ -147,10 +153,79 @@ bool HitCollectorManager::doCreateOneDimensionHitCollector(
         POOL_DELETE_CLASS(rankComp);
         return false;
     }
+    if (!distDescription) {
+        prepareScoreUpperBound(sortExprs, request, hitCollector);
+    }
     setRankHitCollector(hitCollector);
     return true;
 }
 
+void HitCollectorManager::prepareScoreUpperBound(
+        const SortExpressionVector &sortExprs,
+        const Request *request,
+        HitCollectorBase *hitCollector)
+{
+    ConfigClause *configClause = request->getConfigClause();
+    if (!configClause) {
+        return;
+    }
+    const string boundExprStr = configClause->getKVPairValue(RANK_SCORE_UPPER_BOUND);
+    if (boundExprStr.empty()) {
+        return;
+    }
+    // bound only prunes when higher score is better
+    if (sortExprs[0]->getSortFlag()) {
+        AUTIL_LOG(DEBUG, "first rank sort is ascending, ignore score upper bound [%s]",
+                  boundExprStr.c_str());
+        return;
+    }
+    auto scoreRef = dynamic_cast<matchdoc::Reference<score_t> *>(
+            sortExprs[0]->getReferenceBase());
+    if (!scoreRef) {
+        AUTIL_LOG(WARN, "first rank sort is not score, ignore score upper bound [%s]",
+                  boundExprStr.c_str());
+        return;
+    }
+    unique_ptr<SyntaxExpr> syntaxExpr(SyntaxParser::parseSyntax(boundExprStr));
+    if (!syntaxExpr) {
+        AUTIL_LOG(WARN, "parse score upper bound [%s] failed", boundExprStr.c_str());
+        return;
+    }
+    AttributeExpression *boundExpr =
+        _attrExprCreator->createAttributeExpression(syntaxExpr.get());
+    if (!boundExpr || boundExpr->isMultiValue()) {
+        AUTIL_LOG(WARN, "score upper bound [%s] is not a single value expression",
+                  boundExprStr.c_str());
+        return;
+    }
+    // any numeric bound is compared as score_t
+    HitCollectorBase::ScoreUpperBoundEvaluator evaluator = NULL;
+    switch (boundExpr->getType()) {
+#define SCORE_UPPER_BOUND_CASE_HELPER(vt_type)                          \
+        case vt_type: {                                                 \
+            typedef VariableTypeTraits<vt_type, false>::AttrExprType T; \
+            if (dynamic_cast<AttributeExpressionTyped<T> *>(boundExpr)) { \
+                evaluator = &HitCollectorBase::evaluateScoreUpperBound<T>; \
+            }                                                           \
+            break;                                                      \
+        }
+        NUMERIC_VARIABLE_TYPE_MACRO_HELPER(SCORE_UPPER_BOUND_CASE_HELPER);
+#undef SCORE_UPPER_BOUND_CASE_HELPER
+    default:
+        break;
+    }
+    if (!evaluator) {
+        AUTIL_LOG(WARN, "score upper bound [%s] is not a numeric expression",
+                  boundExprStr.c_str());
+        return;
+    }
+    if (!boundExpr->allocate(_matchDocAllocatorPtr.get())) {
+        AUTIL_LOG(WARN, "allocate score upper bound [%s] failed", boundExprStr.c_str());
+        return;
+    }
+    hitCollector->setScoreUpperBound(boundExpr, evaluator, scoreRef);
+}
+
 bool HitCollectorManager::doCreateMultiDimensionHitCollector(
         const vector<SortExpressionVector> &rankSortExpressions,
         const Request *request, uint32_t topK)
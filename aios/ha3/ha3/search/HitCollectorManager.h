@@ -100,6 +100,10 @@ private:
             const std::vector<SortExpressionVector> &rankSortExpressions,
             const common::Request *request, uint32_t topK);
 
+    void prepareScoreUpperBound(const SortExpressionVector &sortExprs,
+                                const common::Request *request,
+                                rank::HitCollectorBase *hitCollector);
+
     bool doCreateMultiDimensionHitCollector(
             const std::vector<SortExpressionVector> &rankSortExpressions,
             const common::Request *request, uint32_t topK);
@@ -80,9 +80,11 @@
 #include "ha3/search/Optimizer.h"
 #include "ha3/search/OptimizerChain.h"
 #include "ha3/search/OptimizerChainManager.h"
+#include "ha3/search/PostingResultCache.h"
 #include "ha3/search/RankResource.h"
 #include "ha3/search/RerankProcessor.h"
 #include "ha3/search/SearchCommonResource.h"
+#include "ha3/search/SearcherCache.h"
 #include "ha3/search/SearcherCacheInfo.h"
 #include "ha3/search/SearcherCacheManager.h"
 #include "ha3/search/SeekAndRankProcessor.h"
@@ -190,6 +192,7 @@ bool MatchDocSearcher::seek(const common::Request *request,
     std::shared_ptr<MatchDocSearchStrategy> searchStrategy(new MatchDocSearchStrategy(docCountLimits));
     SeekAndRankResult seekResult = _seekAndRankProcessor.processWithCache(
             request, searchCacheInfo, innerResult);
+    reportPostingCacheMetrics();
     _rerankProcessor.process(request, seekResult.ranked, seekResult.rankComp, innerResult);
     if (searchCacheInfo) {
         searchCacheInfo->fillAfterRerank(innerResult.actualMatchDocs);
@@ -211,6 +214,18 @@ bool MatchDocSearcher::seek(const common::Request *request,
     return true;
 }
 
+void MatchDocSearcher::reportPostingCacheMetrics() {
+    const auto &readerWrapper = _partitionResource.indexPartitionReaderWrapper;
+    PostingResultCache *postingResultCache = readerWrapper->getPostingResultCache();
+    if (!postingResultCache || !_resource.sessionMetricsCollector) {
+        return;
+    }
+    auto collector = _resource.sessionMetricsCollector;
+    collector->setPostingCacheHitCount(readerWrapper->getPostingCacheHitCount());
+    collector->setPostingCacheMissCount(readerWrapper->getPostingCacheMissCount());
+    collector->setPostingCacheMemUse(postingResultCache->getMemUse());
+}
+
 bool MatchDocSearcher::initAuxJoin(HashJoinInfo *hashJoinInfo) {
     const std::string &joinAttributeName = hashJoinInfo->getJoinFieldName();
     AttributeExpression *expr =
@@ -260,6 +275,7 @@ bool MatchDocSearcher::seekAndJoin(const common::Request *request,
     std::shared_ptr<MatchDocSearchStrategy> searchStrategy(new MatchDocSearchStrategy(docCountLimits));
     SeekAndRankResult seekResult = _seekAndRankProcessor.processWithCacheAndJoinInfo(
                     request, searchCacheInfo, hashJoinInfo, innerResult);
+    reportPostingCacheMetrics();
     _rerankProcessor.process(request, seekResult.ranked, seekResult.rankComp, innerResult);
     if (searchCacheInfo) {
         searchCacheInfo->fillAfterRerank(innerResult.actualMatchDocs);
@@ -334,6 +350,11 @@ bool MatchDocSearcher::doInit(const common::Request *request) {
             getMatchDocMaxCount(_processorResource.docCountLimits.runtimeTopK));
     _partitionResource.indexPartitionReaderWrapper->setSessionPool(
             _resource.pool);
+    SearcherCache *searcherCache = _searcherCacheManager.getSearcherCache();
+    if (searcherCache) {
+        _partitionResource.indexPartitionReaderWrapper->setPostingResultCache(
+                searcherCache->getPostingResultCache());
+    }
 
     if (!doOptimize(request,
                     _partitionResource.indexPartitionReaderWrapper.get())) {
@@ -110,6 +110,7 @@ private:
     common::MatchDocs *createMatchDocs(InnerSearchResult &innerResult) const;
     common::Result *constructResult(InnerSearchResult &innerResult) const;
     bool initAuxJoin(search::HashJoinInfo *hashJoinInfo);
+    void reportPostingCacheMetrics();
 
 private:
     SearchCommonResource &_resource;
@@ -253,10 +253,11 @@ uint32_t RankSearcher::searchMultiLayers(RankSearcherResource &resource,
                            truncateChainFactor);
         matchCount += seekResult._matchCount;
         seekDocCount += seekResult._seekDocCount;
-        REQUEST_TRACE(DEBUG, "layer seekCount:[ %u ], leftQuota:[ %u ], "
+        REQUEST_TRACE(DEBUG, "layer seekCount:[ %u ], seekDocCount:[ %u ], leftQuota:[ %u ], "
                       "matchCount:[ %u ], truncate ChainFactor:[ %f ],"
                       "total seekCount [ %u ], total matchCount [ %u ]",
-                      seekResult._seekCount, seekResult._leftQuota,
+                      seekResult._seekCount, seekResult._seekDocCount,
+                      seekResult._leftQuota,
                       seekResult._matchCount, truncateChainFactor,
                       estimator.getTotalSeekedCount(),
                       estimator.getTotalMatchCount());
@@ -367,10 +368,11 @@ uint32_t RankSearcher::searchMultiLayersWithJoin(
                            truncateChainFactor);
         matchCount += seekResult._matchCount;
         seekDocCount += seekResult._seekDocCount;
-        REQUEST_TRACE(DEBUG, "layer seekCount:[ %u ], leftQuota:[ %u ], "
+        REQUEST_TRACE(DEBUG, "layer seekCount:[ %u ], seekDocCount:[ %u ], leftQuota:[ %u ], "
                       "matchCount:[ %u ], truncate ChainFactor:[ %f ],"
                       "total seekCount [ %u ], total matchCount [ %u ]",
-                      seekResult._seekCount, seekResult._leftQuota,
+                      seekResult._seekCount, seekResult._seekDocCount,
+                      seekResult._leftQuota,
                       seekResult._matchCount, truncateChainFactor,
                       estimator.getTotalSeekedCount(),
                       estimator.getTotalMatchCount());
@@ -636,8 +638,13 @@ QueryExecutor* RankSearcher::createQueryExecutor(const Query *query,
         AUTIL_LOG(DEBUG, "query:[%p]", query);
         QueryExecutorCreator qeCreator(_matchDataManager, wrapper, _pool,
                 _timeoutTerminator, layerMeta);
+        qeCreator.setCollectCostPlan(_tracer && _tracer->isLevelEnabled(ISEARCH_TRACE_DEBUG));
         query->accept(&qeCreator);
         queryExecutor = qeCreator.stealQuery();
+        for (const auto &costPlan : qeCreator.getCostPlans()) {
+            REQUEST_TRACE(DEBUG, "%s", costPlan.c_str());
+        }
+        REQUEST_TRACE(DEBUG, "query executor:[ %s ]", queryExecutor->toString().c_str());
         if (queryExecutor->isEmpty()) {
             POOL_DELETE_CLASS(queryExecutor);
             queryExecutor = NULL;
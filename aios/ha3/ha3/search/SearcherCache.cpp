@@ -68,6 +68,13 @@ bool SearcherCache::init(const SearcherCacheConfig &config) {
     _memCache = new util::MemCache;
 
     _pool->init(CACHE_ITEM_BLOCK_SIZE);
+    if (config.postingCacheSize > 0) {
+        _postingResultCache.reset(new PostingResultCache(
+                        ((size_t)config.postingCacheSize) << 20,
+                        config.postingCacheAdmitCount,
+                        (df_t)config.postingCacheMinDocFreq,
+                        (df_t)config.postingCacheMaxDocFreq));
+    }
     return _memCache->init(((uint64_t)config.maxSize) << 20,
                            config.maxItemNum, _pool);
 }
@@ -87,6 +94,16 @@ bool SearcherCache::put(
     return doPut(key, partRange, cacheResult, pool);
 }
 
+bool SearcherCache::refresh(uint64_t key, autil::PartitionRange partRange,
+                            const CacheResult *cacheResult, Pool *pool)
+{
+    assert(cacheResult);
+    if (!validateCachedDocNum(cacheResult)) {
+        return false;
+    }
+    return doPut(key, partRange, cacheResult, pool);
+}
+
 bool SearcherCache::doPut(uint64_t key, autil::PartitionRange partRange,
                           const CacheResult *cacheResult, Pool *pool)
 {
@@ -22,6 +22,7 @@
 #include "autil/Log.h" // IWYU pragma: keep
 #include "autil/RangeUtil.h"
 #include "ha3/config/SearcherCacheConfig.h"
+#include "ha3/search/PostingResultCache.h"
 #include "ha3/search/SearcherCacheStrategy.h"
 #include "ha3/util/memcache/atomic.h"
 
@@ -70,6 +71,10 @@ public:
     bool put(uint64_t key, autil::PartitionRange partRange, uint32_t curTime,
              const SearcherCacheStrategyPtr &searcherCacheStrategyPtr,
              CacheResult *cacheResult, autil::mem_pool::Pool *pool);
+    // overwrite an item with a result merged from the cached and the
+    // incremental docs, header of cacheResult is kept as is.
+    bool refresh(uint64_t key, autil::PartitionRange partRange,
+                 const CacheResult *cacheResult, autil::mem_pool::Pool *pool);
 
     bool validateCacheResult(
             uint64_t key, autil::PartitionRange partRange, bool useTruncate,
@@ -81,6 +86,10 @@ public:
         return totalMatchDocs >= _config.incDocLimit;
     }
 
+    bool incRefreshEnabled() const {
+        return _config.incRefreshEnable;
+    }
+
     void deleteCacheItem(uint64_t key, autil::PartitionRange partRange);
 
     const config::SearcherCacheConfig& getConfig() const {
@@ -92,6 +101,10 @@ public:
     }
 
     void getCacheStat(uint64_t &memUse, uint32_t &itemNum);
+
+    PostingResultCache *getPostingResultCache() const {
+        return _postingResultCache.get();
+    }
 public:
     inline void increaseCacheGetNum() {atomic32_inc(&_cacheGetNum);}
     inline void increaseCacheHitNum() {atomic32_inc(&_cacheHitNum);}
@@ -130,6 +143,7 @@ private:
     util::MemCache *_memCache;
     util::atomic32_t _cacheGetNum;
     util::atomic32_t _cacheHitNum;
+    PostingResultCachePtr _postingResultCache;
 private:
     AUTIL_LOG_DECLARE();
 };
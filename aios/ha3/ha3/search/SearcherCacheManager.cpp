@@ -129,6 +129,9 @@ bool SearcherCacheManager::initCacheBeforeOptimize(const Request *request,
         return true;
     }
     recoverDocIds(_cacheResult, _indexPartReaderWrapper);
+    if (_cacheResult->getResult() && _cacheResult->getResult()->getMatchDocs()) {
+        _cachedDocCount = _cacheResult->getResult()->getMatchDocs()->size();
+    }
     // disable truncate if necessary
     ConfigClause *configClause = request->getConfigClause();
     bool useTruncate = configClause->useTruncateOptimizer()
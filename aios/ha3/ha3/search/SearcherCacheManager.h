@@ -115,6 +115,9 @@ public:
     CacheResult* getCacheResult() const {
         return _cacheResult;
     }
+    uint32_t getCachedDocCount() const {
+        return _cachedDocCount;
+    }
     const DefaultSearcherCacheStrategyPtr& getCacheStrategy() const {
         return _cacheStrategy;
     }
@@ -144,6 +147,7 @@ private:
     SearcherCache *_searcherCache = nullptr;
     DefaultSearcherCacheStrategyPtr _cacheStrategy;
     CacheResult* _cacheResult = nullptr;
+    uint32_t _cachedDocCount = 0;
     autil::mem_pool::Pool *_pool = nullptr;
     IndexPartitionReaderWrapperPtr _indexPartReaderWrapper;
     suez::turing::FunctionManager *_funcManager = nullptr;
@@ -16,7 +16,9 @@
 #pragma once
 
 #include <assert.h>
+#include <stdint.h>
 #include <memory>
+#include <utility>
 
 #include "autil/Log.h" // IWYU pragma: keep
 #include "matchdoc/MatchDoc.h"
@@ -46,6 +48,9 @@ private:
     Filter(const Filter &filter);
 public:
     inline bool pass(matchdoc::MatchDoc doc);
+    // move docs passing filter to the front in order, return their count.
+    // expression with a reference evaluates all docs in one batchEvaluate
+    inline uint32_t batchPass(matchdoc::MatchDoc *matchDocs, uint32_t count);
 
     inline bool needFilterSubDoc() const {
         return _attributeExpr->isSubExpression();
@@ -76,5 +81,26 @@ inline bool Filter::pass(matchdoc::MatchDoc doc) {
     return _attributeExpr->evaluateAndReturn(doc);
 }
 
+inline uint32_t Filter::batchPass(matchdoc::MatchDoc *matchDocs, uint32_t count) {
+    assert(_attributeExpr);
+    uint32_t passCount = 0;
+    auto ref = _attributeExpr->getReference();
+    if (ref == nullptr) {
+        for (uint32_t i = 0; i < count; ++i) {
+            if (_attributeExpr->evaluateAndReturn(matchDocs[i])) {
+                std::swap(matchDocs[passCount++], matchDocs[i]);
+            }
+        }
+        return passCount;
+    }
+    _attributeExpr->batchEvaluate(matchDocs, count);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (ref->get(matchDocs[i])) {
+            std::swap(matchDocs[passCount++], matchDocs[i]);
+        }
+    }
+    return passCount;
+}
+
 } // namespace search
 } // namespace isearch
@@ -16,7 +16,9 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
 #include <memory>
+#include <utility>
 
 #include "autil/Log.h" // IWYU pragma: keep
 #include "ha3/search/Filter.h"
@@ -51,6 +53,9 @@ private:
     FilterWrapper& operator=(const FilterWrapper &);
 public:
     inline bool pass(matchdoc::MatchDoc matchDoc);
+    // filter a batch stage by stage, docs passing all filters are moved to
+    // the front in order, return their count
+    inline uint32_t batchPass(matchdoc::MatchDoc *matchDocs, uint32_t count);
 public:
     void setFilter(Filter *filter) {
         if (!filter) {
@@ -95,5 +100,30 @@ inline bool FilterWrapper::pass(matchdoc::MatchDoc matchDoc) {
     return true;
 }
 
+inline uint32_t FilterWrapper::batchPass(matchdoc::MatchDoc *matchDocs, uint32_t count) {
+    if (_joinFilter != NULL) {
+        uint32_t passCount = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (_joinFilter->pass(matchDocs[i])) {
+                std::swap(matchDocs[passCount++], matchDocs[i]);
+            }
+        }
+        count = passCount;
+    }
+    if (_subDocFilter != NULL) {
+        uint32_t passCount = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (_subDocFilter->pass(matchDocs[i])) {
+                std::swap(matchDocs[passCount++], matchDocs[i]);
+            }
+        }
+        count = passCount;
+    }
+    if (_filter != NULL) {
+        count = _filter->batchPass(matchDocs, count);
+    }
+    return count;
+}
+
 } // namespace search
 } // namespace isearch
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ha3/search/CachedTermQueryExecutor.h"
+
+#include <algorithm>
+#include <assert.h>
+
+#include "ha3/search/TermMatchData.h"
+#include "indexlib/index/inverted_index/PostingIterator.h"
+
+using namespace std;
+using namespace indexlib::index;
+
+namespace isearch {
+namespace search {
+AUTIL_LOG_SETUP(ha3, CachedTermQueryExecutor);
+
+CachedTermQueryExecutor::CachedTermQueryExecutor(
+    PostingIterator *iter,
+    const common::Term &term,
+    const PostingResultCache::DocIdVectorPtr &cachedDocIds,
+    docid_t cachedEndDocId)
+    : TermQueryExecutor(iter, term)
+    , _cachedDocIds(cachedDocIds)
+    , _cachedEndDocId(cachedEndDocId)
+    , _cursor(0)
+    , _iterDocId(INVALID_DOCID) {
+    assert(_cachedDocIds);
+}
+
+CachedTermQueryExecutor::~CachedTermQueryExecutor() {}
+
+void CachedTermQueryExecutor::reset() {
+    TermQueryExecutor::reset();
+    _cursor = 0;
+    _iterDocId = INVALID_DOCID;
+}
+
+indexlib::index::ErrorCode CachedTermQueryExecutor::doSeek(docid_t id, docid_t &result) {
+    ++_seekDocCount;
+    if (id < _cachedEndDocId) {
+        const auto &docIds = *_cachedDocIds;
+        auto it = std::lower_bound(docIds.begin() + _cursor, docIds.end(), id);
+        _cursor = it - docIds.begin();
+        if (it != docIds.end()) {
+            result = *it;
+            return indexlib::index::ErrorCode::OK;
+        }
+        id = _cachedEndDocId;
+    }
+    docid_t tempDocId = INVALID_DOCID;
+    auto ec = _iter->SeekDocWithErrorCode(id, tempDocId);
+    IE_RETURN_CODE_IF_ERROR(ec);
+    _iterDocId = tempDocId;
+    if (tempDocId == INVALID_DOCID) {
+        tempDocId = END_DOCID;
+    }
+    result = tempDocId;
+    return indexlib::index::ErrorCode::OK;
+}
+
+indexlib::index::ErrorCode CachedTermQueryExecutor::syncPostingIterator() {
+    docid_t docId = getDocId();
+    if (docId >= _cachedEndDocId || docId == _iterDocId) {
+        return indexlib::index::ErrorCode::OK;
+    }
+    docid_t tempDocId = INVALID_DOCID;
+    auto ec = _iter->SeekDocWithErrorCode(docId, tempDocId);
+    IE_RETURN_CODE_IF_ERROR(ec);
+    _iterDocId = tempDocId;
+    assert(tempDocId == docId);
+    return indexlib::index::ErrorCode::OK;
+}
+
+indexlib::index::ErrorCode CachedTermQueryExecutor::unpackMatchData(rank::TermMatchData &tmd) {
+    auto ec = syncPostingIterator();
+    IE_RETURN_CODE_IF_ERROR(ec);
+    return TermQueryExecutor::unpackMatchData(tmd);
+}
+
+matchvalue_t CachedTermQueryExecutor::getMatchValue() {
+    auto ec = syncPostingIterator();
+    if (ec != indexlib::index::ErrorCode::OK) {
+        AUTIL_LOG(WARN, "sync posting iterator failed, term [%s]", _term.toString().c_str());
+        return matchvalue_t();
+    }
+    return TermQueryExecutor::getMatchValue();
+}
+
+std::string CachedTermQueryExecutor::toString() const {
+    return TermQueryExecutor::toString() + "(cached)";
+}
+
+} // namespace search
+} // namespace isearch
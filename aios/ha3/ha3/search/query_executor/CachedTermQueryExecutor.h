@@ -0,0 +1,88 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <stddef.h>
+#include <string>
+
+#include "autil/Log.h" // IWYU pragma: keep
+#include "ha3/search/PostingResultCache.h"
+#include "ha3/search/TermQueryExecutor.h"
+#include "indexlib/index/common/ErrorCode.h"
+#include "indexlib/indexlib.h"
+
+namespace indexlib {
+namespace index {
+class PostingIterator;
+} // namespace index
+} // namespace indexlib
+namespace isearch {
+namespace common {
+class Term;
+} // namespace common
+namespace rank {
+class TermMatchData;
+} // namespace rank
+} // namespace isearch
+
+namespace isearch {
+namespace search {
+
+// seeks docids below cachedEndDocId in a cached docid list and the rest
+// (realtime docs) in the posting iterator. the posting iterator is only
+// moved to a cached doc when its match data is really unpacked.
+class CachedTermQueryExecutor : public TermQueryExecutor {
+public:
+    CachedTermQueryExecutor(indexlib::index::PostingIterator *iter,
+                            const common::Term &term,
+                            const PostingResultCache::DocIdVectorPtr &cachedDocIds,
+                            docid_t cachedEndDocId);
+    ~CachedTermQueryExecutor();
+
+private:
+    CachedTermQueryExecutor(const CachedTermQueryExecutor &);
+    CachedTermQueryExecutor &operator=(const CachedTermQueryExecutor &);
+
+public:
+    const std::string getName() const override {
+        return "CachedTermQueryExecutor";
+    }
+    void reset() override;
+    indexlib::index::ErrorCode unpackMatchData(rank::TermMatchData &tmd) override;
+    matchvalue_t getMatchValue() override;
+    std::string toString() const override;
+
+protected:
+    indexlib::index::ErrorCode doSeek(docid_t id, docid_t &result) override;
+
+private:
+    indexlib::index::ErrorCode syncPostingIterator();
+
+private:
+    PostingResultCache::DocIdVectorPtr _cachedDocIds;
+    docid_t _cachedEndDocId;
+    size_t _cursor;
+    docid_t _iterDocId;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+typedef std::shared_ptr<CachedTermQueryExecutor> CachedTermQueryExecutorPtr;
+
+} // namespace search
+} // namespace isearch
@@ -20,6 +20,8 @@
 
 #include "alog/Logger.h"
 #include "autil/Log.h"
+#include "autil/StringUtil.h"
+#include "autil/TimeoutTerminator.h"
 #include "autil/mem_pool/PoolBase.h"
 #include "build_service/analyzer/Token.h"
 #include "ha3/common/NumberTerm.h"
@@ -33,6 +35,7 @@
 #include "indexlib/index/normal/primarykey/legacy_primary_key_reader.h"
 #include "indexlib/index/inverted_index/InvertedIndexReader.h"
 #include "indexlib/index/inverted_index/PostingIterator.h"
+#include "indexlib/index/inverted_index/config/InvertedIndexConfig.h"
 #include "indexlib/index/inverted_index/format/TermMeta.h"
 #include "indexlib/index/normal/attribute/accessor/attribute_iterator_base.h"
 #include "indexlib/index/normal/attribute/accessor/attribute_reader.h"
@@ -169,6 +172,88 @@ LookupResult IndexPartitionReaderWrapper::doLookup(const common::Term &term,
     return result;
 }
 
+PostingResultCache::DocIdVectorPtr
+IndexPartitionReaderWrapper::lookupCachedDocIds(const common::Term &term,
+                                                autil::TimeoutTerminator *timer,
+                                                docid_t &cachedEndDocId) {
+    if (!_postingResultCache || !_partitionInfoWrapperPtr) {
+        return PostingResultCache::DocIdVectorPtr();
+    }
+    // patches of updatable indexes change built segments without a new inc version
+    auto schema = getSchema();
+    if (!schema) {
+        return PostingResultCache::DocIdVectorPtr();
+    }
+    auto indexConfig = std::dynamic_pointer_cast<indexlibv2::config::InvertedIndexConfig>(
+        schema->GetIndexConfig(indexlib::index::INVERTED_INDEX_TYPE_STR, term.getIndexName()));
+    if (!indexConfig || indexConfig->IsIndexUpdatable()) {
+        return PostingResultCache::DocIdVectorPtr();
+    }
+    cachedEndDocId = (docid_t)_partitionInfoWrapperPtr->GetIncDocCount();
+    if (cachedEndDocId <= 0) {
+        return PostingResultCache::DocIdVectorPtr();
+    }
+    // built segments only change with a new inc version, the range suffix
+    // of partial wrapper is left out since cached docids cover all ranges.
+    string key;
+    IndexPartitionReaderWrapper::getTermKeyStr(term, NULL, key);
+    key.append(1, '\t');
+    key += autil::StringUtil::toString(
+        _partitionInfoWrapperPtr->GetPartitionInfoHint().lastIncSegmentId);
+    key.append(1, '\t');
+    key += autil::StringUtil::toString(cachedEndDocId);
+    auto docIds = _postingResultCache->get(key);
+    if (docIds) {
+        ++_postingCacheHitCount;
+        return docIds;
+    }
+    ++_postingCacheMissCount;
+    if (!_postingResultCache->admit(key)) {
+        return docIds;
+    }
+
+    std::shared_ptr<InvertedIndexReader> indexReaderPtr;
+    bool isSubIndex = false;
+    if (!getIndexReader(term.getIndexName(), indexReaderPtr, isSubIndex) || isSubIndex) {
+        return docIds;
+    }
+    unique_ptr<indexlib::index::Term> indexTermPtr(createIndexTerm(term));
+    PostingType pt1;
+    PostingType pt2;
+    truncateRewrite(term.getTruncateName(), *indexTermPtr, pt1, pt2);
+    LookupResult result
+        = doLookupWithoutCache(indexReaderPtr, isSubIndex, *indexTermPtr, pt1, pt2, NULL);
+    PostingIterator *iter = result.postingIt;
+    if (!iter || !_postingResultCache->isDocFreqCacheable(iter->GetTermMeta()->GetDocFreq())) {
+        return docIds;
+    }
+    auto newDocIds = std::make_shared<PostingResultCache::DocIdVector>();
+    newDocIds->reserve(iter->GetTermMeta()->GetDocFreq());
+    docid_t docId = INVALID_DOCID;
+    while (true) {
+        if (timer && timer->checkRestrictTimeout()) {
+            AUTIL_LOG(DEBUG, "scan posting of term [%s:%s] timeout, skip posting result cache",
+                      term.getIndexName().c_str(), term.getWord().c_str());
+            return docIds;
+        }
+        auto ec = iter->SeekDocWithErrorCode(docId + 1, docId);
+        if (ec != indexlib::index::ErrorCode::OK) {
+            AUTIL_LOG(WARN,
+                      "scan posting of term [%s:%s] failed, skip posting result cache",
+                      term.getIndexName().c_str(),
+                      term.getWord().c_str());
+            return docIds;
+        }
+        if (docId == INVALID_DOCID || docId >= cachedEndDocId) {
+            break;
+        }
+        newDocIds->push_back(docId);
+    }
+    newDocIds->shrink_to_fit();
+    _postingResultCache->put(key, newDocIds);
+    return newDocIds;
+}
+
 void IndexPartitionReaderWrapper::truncateRewrite(const std::string &truncateName,
                                                   indexlib::index::Term &indexTerm,
                                                   PostingType &pt1,
@@ -420,6 +505,31 @@ bool IndexPartitionReaderWrapper::getSortedDocIdRanges(
     return false;
 }
 
+bool IndexPartitionReaderWrapper::getZoneMapDocIdRanges(
+    const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>> &dimensions,
+    const indexlib::DocIdRange &rangeLimit,
+    indexlib::DocIdRangeVector &resultRanges) const {
+    if (_tabletReader) {
+        auto normalTabletReader
+            = std::dynamic_pointer_cast<indexlibv2::table::NormalTabletSessionReader>(_tabletReader);
+        if (normalTabletReader) {
+            return normalTabletReader->GetZoneMapDocIdRanges(dimensions, rangeLimit, resultRanges);
+        }
+    }
+    return false;
+}
+
+bool IndexPartitionReaderWrapper::hasZoneMap(const string &attrName) const {
+    if (_tabletReader) {
+        auto normalTabletReader
+            = std::dynamic_pointer_cast<indexlibv2::table::NormalTabletSessionReader>(_tabletReader);
+        if (normalTabletReader) {
+            return normalTabletReader->HasZoneMap(attrName);
+        }
+    }
+    return false;
+}
+
 bool IndexPartitionReaderWrapper::getIndexReader(const string &indexName,
                                                  std::shared_ptr<InvertedIndexReader> &indexReader,
                                                  bool &isSubIndex) {
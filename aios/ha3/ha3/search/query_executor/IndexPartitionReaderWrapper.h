@@ -27,6 +27,7 @@
 #include "autil/Log.h" // IWYU pragma: keep
 #include "ha3/search/PartitionInfoWrapper.h"
 #include "ha3/isearch.h"
+#include "ha3/search/PostingResultCache.h"
 #include "indexlib/index/normal/attribute/accessor/join_docid_attribute_iterator.h"
 #include "indexlib/index/inverted_index/InvertedIndexReader.h"
 #include "indexlib/index/inverted_index/PostingIterator.h"
@@ -36,6 +37,7 @@
 #include "indexlib/partition/partition_define.h"
 
 namespace autil {
+class TimeoutTerminator;
 namespace mem_pool {
 class Pool;
 } // namespace mem_pool
@@ -179,6 +181,11 @@ public:
         const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>> &dimensions,
             const indexlib::DocIdRange &rangeLimits,
             indexlib::DocIdRangeVector &resultRanges) const;
+    virtual bool getZoneMapDocIdRanges(
+        const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>> &dimensions,
+            const indexlib::DocIdRange &rangeLimit,
+            indexlib::DocIdRangeVector &resultRanges) const;
+    virtual bool hasZoneMap(const std::string &attrName) const;
 
 public:
     void setTopK(uint32_t topK) {
@@ -190,6 +197,24 @@ public:
     void setSessionPool(autil::mem_pool::Pool *sessionPool) {
         _sessionPool = sessionPool;
     }
+    void setPostingResultCache(PostingResultCache *postingResultCache) {
+        _postingResultCache = postingResultCache;
+    }
+    PostingResultCache *getPostingResultCache() const {
+        return _postingResultCache;
+    }
+    // docids hit by term in built segments, null if no posting result
+    // cache is set or the term is not cached (yet). updatable indexes are
+    // never cached, and admission gives up when timer expires.
+    PostingResultCache::DocIdVectorPtr lookupCachedDocIds(const common::Term &term,
+                                                          autil::TimeoutTerminator *timer,
+                                                          docid_t &cachedEndDocId);
+    uint32_t getPostingCacheHitCount() const {
+        return _postingCacheHitCount;
+    }
+    uint32_t getPostingCacheMissCount() const {
+        return _postingCacheMissCount;
+    }
 
 protected:
     virtual void
@@ -266,6 +291,9 @@ protected:
     size_t _tracerCursor = 0;
     uint32_t _topK;
     autil::mem_pool::Pool *_sessionPool = nullptr;
+    PostingResultCache *_postingResultCache = nullptr;
+    uint32_t _postingCacheHitCount = 0;
+    uint32_t _postingCacheMissCount = 0;
     // for sub partition seek
     DocMapAttrIterator *_main2SubIt = nullptr;
     DocMapAttrIterator *_sub2MainIt = nullptr;
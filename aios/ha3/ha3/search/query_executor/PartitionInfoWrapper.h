@@ -46,6 +46,7 @@ public:
     indexlib::index::PartitionInfoHint GetPartitionInfoHint() const;
     std::shared_ptr<indexlib::index_base::PartitionMeta> GetPartitionMeta() const;
     size_t GetTotalDocCount() const;
+    size_t GetIncDocCount() const;
     size_t GetSegmentCount() const;
     globalid_t GetGlobalId(docid_t docId) const;
     docid_t GetDocId(const indexlib::index::PartitionInfoHint &infoHint, globalid_t gid) const;
@@ -123,6 +124,14 @@ inline size_t PartitionInfoWrapper::GetTotalDocCount() const {
     return _partitionInfoPtr->GetTotalDocCount();
 }
 
+inline size_t PartitionInfoWrapper::GetIncDocCount() const {
+    if (_normalTabletInfoPtr) {
+        return _normalTabletInfoPtr->GetIncDocCount();
+    }
+    assert(_partitionInfoPtr);
+    return _partitionInfoPtr->GetPartitionMetrics().incDocCount;
+}
+
 inline size_t PartitionInfoWrapper::GetSegmentCount() const {
     if (_normalTabletInfoPtr) {
         return _normalTabletInfoPtr->GetSegmentCount();
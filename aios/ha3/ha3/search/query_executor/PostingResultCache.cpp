@@ -0,0 +1,75 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ha3/search/PostingResultCache.h"
+
+#include "autil/HashAlgorithm.h"
+
+using namespace std;
+using namespace autil;
+
+namespace isearch {
+namespace search {
+AUTIL_LOG_SETUP(ha3, PostingResultCache);
+
+PostingResultCache::PostingResultCache(size_t memSizeLimit,
+                                       uint32_t admitCount,
+                                       df_t minDocFreq,
+                                       df_t maxDocFreq)
+    : _lruCache(memSizeLimit)
+    , _admitCount(admitCount)
+    , _minDocFreq(minDocFreq)
+    , _maxDocFreq(maxDocFreq) {
+    // docids of a larger term never fit in one slice, do not scan for them
+    size_t sliceDocCount = _lruCache.getSliceMemSizeLimit() / sizeof(docid_t);
+    if ((size_t)_maxDocFreq > sliceDocCount) {
+        _maxDocFreq = (df_t)sliceDocCount;
+    }
+}
+
+PostingResultCache::~PostingResultCache() {}
+
+PostingResultCache::DocIdVectorPtr PostingResultCache::get(const string &key) {
+    DocIdVectorPtr docIds;
+    _lruCache.get(key, docIds);
+    return docIds;
+}
+
+bool PostingResultCache::admit(const string &key) {
+    auto &slice = getAdmitSlice(key);
+    ScopedLock lock(slice.mutex);
+    if (slice.lookupCounts.size() >= MAX_LOOKUP_COUNT_SIZE) {
+        slice.lookupCounts.clear();
+    }
+    uint32_t &count = slice.lookupCounts[key];
+    ++count;
+    if (count < _admitCount) {
+        return false;
+    }
+    slice.lookupCounts.erase(key);
+    return true;
+}
+
+void PostingResultCache::put(const string &key, const DocIdVectorPtr &docIds) {
+    _lruCache.put(key, docIds, sizeof(DocIdVector) + docIds->size() * sizeof(docid_t));
+}
+
+PostingResultCache::AdmitSlice &PostingResultCache::getAdmitSlice(const string &key) {
+    uint64_t hashKey = HashAlgorithm::hashString64(key.c_str(), key.size());
+    return _admitSlices[hashKey % ADMIT_SLICE_SIZE];
+}
+
+} // namespace search
+} // namespace isearch
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "autil/Lock.h"
+#include "autil/Log.h" // IWYU pragma: keep
+#include "ha3/util/SlicedLruCache.h"
+#include "indexlib/indexlib.h"
+
+namespace isearch {
+namespace search {
+
+// cross query cache of the docids a term hits in the built segments.
+// keys carry the inc version watermark of the partition, so items of an
+// old version are never hit again and age out in lru order. a term is
+// materialized only after it is looked up admitCount times, cold terms
+// never pay for a full posting scan. the scan runs in the query that admits
+// the term, so terms above maxDocFreq or too large for a cache slice are
+// never materialized.
+class PostingResultCache {
+public:
+    typedef std::vector<docid_t> DocIdVector;
+    typedef std::shared_ptr<const DocIdVector> DocIdVectorPtr;
+
+public:
+    PostingResultCache(size_t memSizeLimit, uint32_t admitCount, df_t minDocFreq, df_t maxDocFreq);
+    ~PostingResultCache();
+
+private:
+    PostingResultCache(const PostingResultCache &);
+    PostingResultCache &operator=(const PostingResultCache &);
+
+public:
+    DocIdVectorPtr get(const std::string &key);
+    // count one more lookup of key, return true if key is hot enough to be put.
+    bool admit(const std::string &key);
+    void put(const std::string &key, const DocIdVectorPtr &docIds);
+    size_t getMemUse() const {
+        return _lruCache.getMemUse();
+    }
+    size_t getItemCount() const {
+        return _lruCache.getItemCount();
+    }
+    bool isDocFreqCacheable(df_t docFreq) const {
+        return docFreq >= _minDocFreq && docFreq <= _maxDocFreq;
+    }
+
+private:
+    struct AdmitSlice {
+        autil::ThreadMutex mutex;
+        std::unordered_map<std::string, uint32_t> lookupCounts;
+    };
+
+private:
+    AdmitSlice &getAdmitSlice(const std::string &key);
+
+private:
+    static const size_t ADMIT_SLICE_SIZE = 16;
+    static const size_t MAX_LOOKUP_COUNT_SIZE = 4096;
+    util::SlicedLruCache<DocIdVectorPtr> _lruCache;
+    AdmitSlice _admitSlices[ADMIT_SLICE_SIZE];
+    uint32_t _admitCount;
+    df_t _minDocFreq;
+    df_t _maxDocFreq;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+typedef std::shared_ptr<PostingResultCache> PostingResultCachePtr;
+
+} // namespace search
+} // namespace isearch
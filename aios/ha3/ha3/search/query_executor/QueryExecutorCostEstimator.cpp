@@ -0,0 +1,108 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ha3/search/QueryExecutorCostEstimator.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "autil/Log.h"
+#include "ha3/search/LayerMetas.h"
+#include "ha3/search/QueryExecutor.h"
+
+using namespace std;
+
+namespace isearch {
+namespace search {
+AUTIL_LOG_SETUP(ha3, QueryExecutorCostEstimator);
+
+QueryExecutorCostEstimator::QueryExecutorCostEstimator(const LayerMeta *layerMeta)
+    : _layerDocCount(0)
+{
+    if (layerMeta) {
+        for (const auto &rangeMeta : *layerMeta) {
+            if (rangeMeta.end >= rangeMeta.begin) {
+                _layerDocCount += rangeMeta.end - rangeMeta.begin + 1;
+            }
+        }
+    }
+}
+
+QueryExecutorCostEstimator::~QueryExecutorCostEstimator() {
+}
+
+bool QueryExecutorCostEstimator::isBitmapExecutor(const QueryExecutor *queryExecutor) {
+    return queryExecutor->getName() == "BitmapTermQueryExecutor";
+}
+
+double QueryExecutorCostEstimator::estimateSeekCost(const QueryExecutor *queryExecutor,
+                                                    df_t leadDF) const
+{
+    df_t df = max(queryExecutor->getCurrentDF(), (df_t)1);
+    double seekCount = (double)min(df, leadDF);
+    if (!isBitmapExecutor(queryExecutor)) {
+        return seekCount * POSTING_SEEK_COST;
+    }
+    // a bitmap seek scans words up to the next set bit
+    double gapWords = _layerDocCount > 0
+                      ? (double)_layerDocCount / df / BITMAP_WORD_BITS : 0.0;
+    return seekCount * (1.0 + gapWords);
+}
+
+double QueryExecutorCostEstimator::estimateAndCost(
+        const vector<QueryExecutor *> &queryExecutors) const
+{
+    if (queryExecutors.empty()) {
+        return 0.0;
+    }
+    df_t leadDF = numeric_limits<df_t>::max();
+    for (auto queryExecutor : queryExecutors) {
+        leadDF = min(leadDF, queryExecutor->getCurrentDF());
+    }
+    double cost = 0.0;
+    for (auto queryExecutor : queryExecutors) {
+        cost += estimateSeekCost(queryExecutor, leadDF);
+    }
+    return cost;
+}
+
+double QueryExecutorCostEstimator::estimateBitmapAndCost(
+        const vector<QueryExecutor *> &queryExecutors) const
+{
+    vector<QueryExecutor *> seekExecutors;
+    vector<QueryExecutor *> bitmapExecutors;
+    for (auto queryExecutor : queryExecutors) {
+        if (isBitmapExecutor(queryExecutor)) {
+            bitmapExecutors.push_back(queryExecutor);
+        } else {
+            seekExecutors.push_back(queryExecutor);
+        }
+    }
+    if (seekExecutors.empty() && !bitmapExecutors.empty()) {
+        auto iter = min_element(bitmapExecutors.begin(), bitmapExecutors.end(),
+                                QueryExecutor::DFCompare());
+        seekExecutors.push_back(*iter);
+        bitmapExecutors.erase(iter);
+    }
+    df_t candidateCount = numeric_limits<df_t>::max();
+    for (auto queryExecutor : seekExecutors) {
+        candidateCount = min(candidateCount, queryExecutor->getCurrentDF());
+    }
+    return estimateAndCost(seekExecutors)
+        + (double)candidateCount * bitmapExecutors.size() * BITMAP_TEST_COST;
+}
+
+} // namespace search
+} // namespace isearch
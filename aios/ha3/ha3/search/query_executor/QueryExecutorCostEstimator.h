@@ -0,0 +1,72 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "autil/Log.h" // IWYU pragma: keep
+#include "indexlib/indexlib.h"
+
+namespace isearch {
+namespace search {
+
+class QueryExecutor;
+class LayerMeta;
+
+// estimates seek cost of and executor shapes from the df of each child
+// (truncate chains are already reflected in the current chain df) and
+// the doc count of the layer. costs are in units of one posting decode.
+class QueryExecutorCostEstimator {
+public:
+    QueryExecutorCostEstimator(const LayerMeta *layerMeta);
+    ~QueryExecutorCostEstimator();
+
+private:
+    QueryExecutorCostEstimator(const QueryExecutorCostEstimator &);
+    QueryExecutorCostEstimator &operator=(const QueryExecutorCostEstimator &);
+
+public:
+    // leapfrog over all children, the smallest df child leads.
+    double estimateAndCost(const std::vector<QueryExecutor *> &queryExecutors) const;
+    // seek the non bitmap children (or the smallest bitmap), test the rest.
+    double estimateBitmapAndCost(const std::vector<QueryExecutor *> &queryExecutors) const;
+    docid_t getLayerDocCount() const {
+        return _layerDocCount;
+    }
+
+public:
+    static bool isBitmapExecutor(const QueryExecutor *queryExecutor);
+
+private:
+    double estimateSeekCost(const QueryExecutor *queryExecutor, df_t leadDF) const;
+
+private:
+    static constexpr double POSTING_SEEK_COST = 2.0;
+    static constexpr double BITMAP_TEST_COST = 0.5;
+    static constexpr double BITMAP_WORD_BITS = 64.0;
+
+private:
+    docid_t _layerDocCount;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+} // namespace search
+} // namespace isearch
@@ -53,6 +53,7 @@
 #include "ha3/search/BitmapAndQueryExecutor.h"
 #include "ha3/search/BitmapTermQueryExecutor.h"
 #include "ha3/search/BufferedTermQueryExecutor.h"
+#include "ha3/search/CachedTermQueryExecutor.h"
 #include "ha3/search/CompositeTermQueryExecutor.h"
 #include "ha3/search/DocIdTermQueryExecutor.h"
 #include "ha3/search/DocIdsQueryExecutor.h"
@@ -68,7 +69,9 @@
 #include "ha3/search/OrQueryExecutor.h"
 #include "ha3/search/OrQueryMatchRowInfoExecutor.h"
 #include "ha3/search/PhraseQueryExecutor.h"
+#include "ha3/search/PostingResultCache.h"
 #include "ha3/search/QueryExecutor.h"
+#include "ha3/search/QueryExecutorCostEstimator.h"
 #include "ha3/search/QueryExecutorRestrictor.h"
 #include "ha3/search/RangeTermQueryExecutor.h"
 #include "ha3/search/RestrictPhraseQueryExecutor.h"
@@ -110,7 +113,8 @@ QueryExecutorCreator::QueryExecutorCreator(MatchDataManager *matchDataManager,
     , _andnotQueryLevel(0)
     , _pool(pool)
     , _timer(timer)
-    , _layerMeta(layerMeta) {
+    , _layerMeta(layerMeta)
+    , _collectCostPlan(false) {
     if (_matchDataManager) {
         _matchDataManager->beginLayer();
     }
@@ -215,10 +219,38 @@ QueryExecutorCreator::createTermQueryExecutor(IndexPartitionReaderWrapper *reade
     return termQueryExecutor;
 }
 
+TermQueryExecutor *
+QueryExecutorCreator::tryCreateCachedTermQueryExecutor(TermQueryExecutor *termQueryExecutor,
+                                                       const common::Term &queryTerm) {
+    // only plain postings, field map and sub doc executors need the iterator
+    // positioned at every seeked doc.
+    if (!termQueryExecutor || termQueryExecutor->isEmpty()
+        || termQueryExecutor->getName() != "BufferedTermQueryExecutor") {
+        return termQueryExecutor;
+    }
+    docid_t cachedEndDocId = INVALID_DOCID;
+    PostingResultCache::DocIdVectorPtr cachedDocIds
+        = _readerWrapper->lookupCachedDocIds(queryTerm, _timer, cachedEndDocId);
+    if (!cachedDocIds) {
+        return termQueryExecutor;
+    }
+    TermQueryExecutor *cachedExecutor = POOL_NEW_CLASS(_pool,
+                                                       CachedTermQueryExecutor,
+                                                       termQueryExecutor->getPostingIterator(),
+                                                       queryTerm,
+                                                       cachedDocIds,
+                                                       cachedEndDocId);
+    cachedExecutor->setIndexPartitionReaderWrapper(_readerWrapper);
+    // posting iterator is owned by reader wrapper
+    POOL_DELETE_CLASS(termQueryExecutor);
+    return cachedExecutor;
+}
+
 void QueryExecutorCreator::visitTermQuery(const TermQuery *query) {
     assert(_readerWrapper);
     TermQueryExecutor *termQueryExecutor
         = createTermQueryExecutor(_readerWrapper, query->getTerm(), _pool, _layerMeta);
+    termQueryExecutor = tryCreateCachedTermQueryExecutor(termQueryExecutor, query->getTerm());
     addUnpackQuery(termQueryExecutor, query->getTerm(), query);
     _queryExecutor = termQueryExecutor;
 }
@@ -739,7 +771,8 @@ void QueryExecutorCreator::visitTableQuery(const TableQuery *query) {
 #define macroCreateAndQueryExecutor(funcName, andExecutor, bitmapExecutor)                         \
     MultiQueryExecutor *QueryExecutorCreator::funcName(                                            \
         const vector<QueryExecutor *> &queryExecutors) {                                           \
-        if (canConvertToBitmapAndQuery(queryExecutors)) {                                          \
+        if (canConvertToBitmapAndQuery(queryExecutors)                                             \
+            && preferBitmapAndQuery(queryExecutors)) {                                             \
             return POOL_NEW_CLASS(_pool, bitmapExecutor, _pool);                                   \
         } else {                                                                                   \
             return POOL_NEW_CLASS(_pool, andExecutor);                                             \
@@ -764,6 +797,28 @@ macroCreateAndQueryExecutor(createAndQueryExecutor, AndQueryExecutor, BitmapAndQ
     }
     return false;
 }
+
+bool QueryExecutorCreator::preferBitmapAndQuery(const vector<QueryExecutor *> &queryExecutors) {
+    // bitmap and seeks the non bitmap children and tests the bitmaps, which
+    // loses to a plain leapfrog when a bitmap term is the most selective one.
+    QueryExecutorCostEstimator costEstimator(_layerMeta);
+    double andCost = costEstimator.estimateAndCost(queryExecutors);
+    double bitmapAndCost = costEstimator.estimateBitmapAndCost(queryExecutors);
+    bool preferBitmapAnd = bitmapAndCost <= andCost;
+    AUTIL_LOG(DEBUG, "and plan [%s], estimated cost and:[%f] bitmap_and:[%f], layer doc count:[%d]",
+              preferBitmapAnd ? "bitmap_and" : "and", andCost, bitmapAndCost,
+              (int32_t)costEstimator.getLayerDocCount());
+    if (_collectCostPlan) {
+        string costPlan = "and plan [" + string(preferBitmapAnd ? "bitmap_and" : "and")
+                          + "], estimated cost and:[" + StringUtil::toString(andCost)
+                          + "] bitmap_and:[" + StringUtil::toString(bitmapAndCost)
+                          + "], layer doc count:["
+                          + StringUtil::toString(costEstimator.getLayerDocCount()) + "]";
+        _costPlans.push_back(std::move(costPlan));
+    }
+    return preferBitmapAnd;
+}
+
 void QueryExecutorCreator::visitOrQuery(const OrQuery *query) {
     const vector<QueryPtr> *children = query->getChildQuery();
     assert(children);
@@ -88,6 +88,13 @@ public:
     void visitDocIdsQuery(const common::DocIdsQuery *query);
 
     QueryExecutor *stealQuery();
+    // cost plans are only collected for debug trace
+    void setCollectCostPlan(bool collectCostPlan) {
+        _collectCostPlan = collectCostPlan;
+    }
+    const std::vector<std::string> &getCostPlans() const {
+        return _costPlans;
+    }
 
 private:
     static std::string composeTruncateName(const std::string &word, const std::string &chainName) {
@@ -97,9 +104,12 @@ private:
     }
 
     bool canConvertToBitmapAndQuery(const std::vector<QueryExecutor *> &queryExecutors);
+    bool preferBitmapAndQuery(const std::vector<QueryExecutor *> &queryExecutors);
     MultiQueryExecutor *createAndQueryExecutor(const std::vector<QueryExecutor *> &queryExecutors);
     MultiQueryExecutor *
     createMultiTermAndQueryExecutor(const std::vector<QueryExecutor *> &queryExecutors);
+    TermQueryExecutor *tryCreateCachedTermQueryExecutor(TermQueryExecutor *termQueryExecutor,
+                                                        const common::Term &queryTerm);
     void addUnpackQuery(TermQueryExecutor *termQuery,
                         const common::Term &term,
                         const common::Query *query);
@@ -169,6 +179,8 @@ private:
     autil::mem_pool::Pool *_pool;
     common::TimeoutTerminator *_timer;
     const LayerMeta *_layerMeta;
+    std::vector<std::string> _costPlans;
+    bool _collectCostPlan;
 
 private:
     friend class QueryExecutorCreatorTest;
@@ -71,6 +71,7 @@ SingleLayerSearcher::SingleLayerSearcher(
     , _seekTimes(0)
     , _hashJoinInfo(hashJoinInfo)
     , _joinAttrExpr(joinAttrExpr)
+    , _batchCursor(0)
 {
     if (layerMeta->quotaMode == QM_PER_LAYER) {
         _curQuota = layerMeta->maxQuota;
@@ -80,6 +81,89 @@ SingleLayerSearcher::SingleLayerSearcher(
 }
 
 SingleLayerSearcher::~SingleLayerSearcher() {
+    for (size_t i = _batchCursor; i < _batchMatchDocs.size(); ++i) {
+        _matchDocAllocator->deallocate(_batchMatchDocs[i]);
+    }
+}
+
+indexlib::index::ErrorCode SingleLayerSearcher::batchSeek(matchdoc::MatchDoc &matchDoc) {
+    while (_batchCursor >= _batchMatchDocs.size()) {
+        bool seekEnd = false;
+        auto ec = fillBatchMatchDocs(seekEnd);
+        IE_RETURN_CODE_IF_ERROR(ec);
+        if (_batchMatchDocs.empty() && seekEnd) {
+            matchDoc = matchdoc::INVALID_MATCHDOC;
+            return indexlib::index::ErrorCode::OK;
+        }
+    }
+    matchDoc = _batchMatchDocs[_batchCursor++];
+    return indexlib::index::ErrorCode::OK;
+}
+
+indexlib::index::ErrorCode SingleLayerSearcher::fillBatchMatchDocs(bool &seekEnd) {
+    _batchDocIds.clear();
+    _batchMatchDocs.clear();
+    _batchCursor = 0;
+    seekEnd = false;
+
+    // stage 1: seek docids in current range, never more than left quota,
+    // so docs passing filter can not overdraw it
+    docid_t docId = _curDocId;
+    uint32_t batchSize = std::min(BATCH_SEEK_SIZE, _curQuota);
+    while (true) {
+        if (_timeoutTerminator && _timeoutTerminator->checkTimeout()) {
+            seekEnd = true;
+            break;
+        }
+        auto ec = _queryExecutor->seekWithoutCheck(docId, docId);
+        IE_RETURN_CODE_IF_ERROR(ec);
+        if (likely(_curQuota > 0 && _curEnd >= docId)) {
+            _cousorNextBegin = docId + 1;
+        } else if (!_batchDocIds.empty()) {
+            // flush docs of current range before moving to next range
+            break;
+        } else if (moveToCorrectRange(docId)) {
+            batchSize = std::min(BATCH_SEEK_SIZE, _curQuota);
+        } else {
+            if (docId == END_DOCID) {
+                seekEnd = true;
+                break;
+            }
+            continue;
+        }
+        ++_seekTimes;
+        _batchDocIds.push_back(docId++);
+        if (_batchDocIds.size() >= batchSize) {
+            break;
+        }
+    }
+    _curDocId = docId;
+
+    // stage 2: drop deleted docs
+    if (_deletionMapReader) {
+        size_t count = 0;
+        for (size_t i = 0; i < _batchDocIds.size(); ++i) {
+            _batchDocIds[count] = _batchDocIds[i];
+            count += _deletionMapReader->IsDeleted(_batchDocIds[i]) ? 0 : 1;
+        }
+        _batchDocIds.resize(count);
+    }
+    if (_batchDocIds.empty()) {
+        return indexlib::index::ErrorCode::OK;
+    }
+
+    // stage 3: allocate and filter survivors
+    _matchDocAllocator->batchAllocate(_batchDocIds, _batchMatchDocs);
+    if (_filterWrapper) {
+        uint32_t count = _filterWrapper->batchPass(_batchMatchDocs.data(), _batchMatchDocs.size());
+        for (size_t i = count; i < _batchMatchDocs.size(); ++i) {
+            _matchDocAllocator->deallocate(_batchMatchDocs[i]);
+        }
+        _batchMatchDocs.resize(count);
+    }
+    assert(_curQuota >= _batchMatchDocs.size());
+    _curQuota -= _batchMatchDocs.size();
+    return indexlib::index::ErrorCode::OK;
 }
 
 bool SingleLayerSearcher::moveToCorrectRange(docid_t &docId) {
@@ -20,6 +20,7 @@
 #include <stdint.h>
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 #include "autil/CommonMacros.h"
 #include "autil/mem_pool/PoolVector.h"
@@ -58,6 +59,8 @@ class SingleLayerSearcher
 {
 public:
     typedef indexlib::index::JoinDocidAttributeIterator DocMapAttrIterator;
+    // max docs seeked in one block when no match data or sub doc is needed
+    static constexpr uint32_t BATCH_SEEK_SIZE = 1024;
 
 public:
     SingleLayerSearcher(QueryExecutor *queryExecutor,
@@ -109,6 +112,8 @@ private:
     bool moveToCorrectRange(docid_t &docId);
     inline bool tryToMakeItInRange(docid_t &docId);
     indexlib::index::ErrorCode constructSubMatchDocs(matchdoc::MatchDoc matchDoc);
+    indexlib::index::ErrorCode batchSeek(matchdoc::MatchDoc &matchDoc);
+    indexlib::index::ErrorCode fillBatchMatchDocs(bool &seekEnd);
 private:
     docid_t _curDocId;
     docid_t _curBegin;
@@ -130,6 +135,9 @@ private:
     const search::HashJoinInfo *_hashJoinInfo;
     suez::turing::AttributeExpression *_joinAttrExpr;
     std::list<matchdoc::MatchDoc> _matchDocBuffer;
+    std::vector<docid_t> _batchDocIds;
+    std::vector<matchdoc::MatchDoc> _batchMatchDocs;
+    size_t _batchCursor;
 
 private:
     friend class SingleLayerSearcherTest;
@@ -184,6 +192,10 @@ inline indexlib::index::ErrorCode SingleLayerSearcher::seek(
     bool needMatchDataBeforeFilter = needMatchData && _matchDataManager->filterNeedMatchData();
     bool needMatchDataAfterFilter = needMatchData && !_matchDataManager->filterNeedMatchData();
     bool needMatchedRowInfo = _matchDataManager && !_matchDataManager->getMatchDataCollectorCenter().isEmpty();
+    // match data is read from executors positioned at current doc, so only plain seek goes block by block
+    if (!needSubDoc && !needMatchData && !needMatchValues && !needMatchedRowInfo) {
+        return batchSeek(matchDoc);
+    }
     while (true) {
         if (_timeoutTerminator && _timeoutTerminator->checkTimeout()) {
             break;
@@ -52,6 +52,7 @@
 #include "ha3/sql/framework/SqlResultFormatter.h"
 #include "ha3/turing/common/Ha3BizMeta.h"
 #include "ha3/turing/common/ModelConfig.h"
+#include "ha3/turing/qrs/SqlResultCache.h"
 #include "ha3/util/TypeDefine.h"
 #include "kmonitor/client/MetricType.h"
 #include "kmonitor/client/MetricsReporter.h"
@@ -60,6 +61,7 @@
 #include "aios/network/gig/multi_call/interface/QuerySession.h"
 #include "aios/network/gig/multi_call/rpc/GigClosure.h"
 #include "suez/turing/search/SearchContext.h"
+#include "table/Table.h"
 #include "tensorflow/core/framework/resource_handle.pb.h"
 #ifndef AIOS_OPEN_SOURCE
 #include "lockless_allocator/LocklessApi.h"
@@ -146,6 +148,8 @@ void QrsArpcSqlSession::reset() {
     _errorAccessLog = nullptr;
     _request.reset();
     _result.reset();
+    _resultCacheKey.clear();
+    _resultFromCache = false;
     Session::reset();
 }
 
@@ -290,6 +294,12 @@ void QrsArpcSqlSession::processRequest() {
     _result->allowSoftFailure = getAllowSoftFailure(*_sqlQueryRequest);
     _result->sqlQuery = _queryStr;
 
+    initResultCacheKey();
+    if (lookupResultCache(*_result)) {
+        endQrsSession(*_result);
+        return;
+    }
+
     auto sqlHandler = new QrsSqlHandler(_qrsSqlBiz, _gigQuerySession, _timeoutTerminator);
     sqlHandler->setUseGigSrc(_useGigSrc);
     sqlHandler->setGDBPtr(this);
@@ -333,6 +343,7 @@ void QrsArpcSqlSession::endQrsSession(sql::QrsSessionSqlResult &result) {
         _done->setErrorCode(result.multicallEc);
         _done->Run();
     }
+    putResultCache(result, accessLogHelper.get());
     logSqlPattern(result);
     int64_t formatUseTime = 0;
     if (_sessionMetricsCollectorPtr != nullptr) {
@@ -462,6 +473,71 @@ void QrsArpcSqlSession::logSqlPattern(const sql::QrsSessionSqlResult &result) {
     }
 }
 
+void QrsArpcSqlSession::initResultCacheKey() {
+    if (!_qrsSqlBiz->getSqlResultCache()) {
+        return;
+    }
+    if (!getUseResultCache(*_sqlQueryRequest, _qrsSqlBiz)) {
+        return;
+    }
+    _resultCacheKey = SqlResultCache::genCacheKey(
+            _bizName, _qrsSqlBiz->getSearcherDataVersion(), *_sqlQueryRequest);
+}
+
+bool QrsArpcSqlSession::lookupResultCache(sql::QrsSessionSqlResult &result) {
+    if (_resultCacheKey.empty()) {
+        return false;
+    }
+    auto *resultCache = _qrsSqlBiz->getSqlResultCache();
+    string tableData;
+    bool hit = resultCache->get(_resultCacheKey, autil::TimeUtility::currentTime(), tableData);
+    if (_sessionMetricsCollectorPtr) {
+        if (hit) {
+            _sessionMetricsCollectorPtr->increaseSqlResultCacheHitQps();
+        } else {
+            _sessionMetricsCollectorPtr->increaseSqlResultCacheMissQps();
+        }
+        _sessionMetricsCollectorPtr->setSqlResultCacheMemUse(resultCache->getMemUse());
+        _sessionMetricsCollectorPtr->setSqlResultCacheItemCount(resultCache->getItemCount());
+    }
+    if (!hit) {
+        return false;
+    }
+    auto poolPtr = std::make_shared<autil::mem_pool::Pool>();
+    auto cachedTable = std::make_shared<table::Table>(poolPtr);
+    cachedTable->deserializeFromString(tableData, poolPtr.get());
+    result.table = cachedTable;
+    result.multicallEc = multi_call::MULTI_CALL_ERROR_NONE;
+    _resultFromCache = true;
+    if (_sessionMetricsCollectorPtr) {
+        _sessionMetricsCollectorPtr->sqlRunGraphEndTrigger();
+    }
+    if (_accessLog) {
+        _accessLog->setRowCount(cachedTable->getRowCount());
+    }
+    AUTIL_LOG(DEBUG, "sql result cache hit, row count [%lu]", cachedTable->getRowCount());
+    return true;
+}
+
+void QrsArpcSqlSession::putResultCache(const sql::QrsSessionSqlResult &result,
+                                       const SqlAccessLogFormatHelper *accessLogHelper)
+{
+    if (_resultCacheKey.empty() || _resultFromCache) {
+        return;
+    }
+    if (result.errorResult.hasError() || result.table == nullptr) {
+        return;
+    }
+    // partial results from soft failures must not be served to later queries
+    if (accessLogHelper && accessLogHelper->hasSoftFailure()) {
+        return;
+    }
+    string tableData;
+    result.table->serializeToString(tableData, getMemPool());
+    _qrsSqlBiz->getSqlResultCache()->put(
+            _resultCacheKey, autil::TimeUtility::currentTime(), std::move(tableData));
+}
+
 void QrsArpcSqlSession::reportMetrics(MetricsReporter *metricsReporter) {
     if (_sessionMetricsCollectorPtr && metricsReporter) {
         _sessionMetricsCollectorPtr->setRequestType(SessionMetricsCollector::SqlType);
@@ -535,6 +611,28 @@ bool QrsArpcSqlSession::getResultReadable(const sql::SqlQueryRequest &sqlRequest
     return res;
 }
 
+bool QrsArpcSqlSession::getUseResultCache(const sql::SqlQueryRequest &sqlRequest,
+                                          const turing::QrsSqlBizPtr &qrsSqlBiz)
+{
+    if (sqlRequest.getSqlType() != SQL_TYPE_DQL) {
+        return false;
+    }
+    // debug requests carry per query trace and search info in their result
+    std::string info;
+    sqlRequest.getValue(SQL_TRACE_LEVEL, info);
+    if (!info.empty()) {
+        return false;
+    }
+    info.clear();
+    sqlRequest.getValue(SQL_USE_RESULT_CACHE, info);
+    if (info.empty()) {
+        return qrsSqlBiz->getSqlConfig()->sqlConfig.resultCacheDefaultEnable;
+    }
+    bool res = false;
+    StringUtil::fromString(info, res);
+    return res;
+}
+
 bool QrsArpcSqlSession::getAllowSoftFailure(const sql::SqlQueryRequest &sqlRequest) {
     std::string info;
     sqlRequest.getValue(SQL_RESULT_ALLOW_SOFT_FAILURE, info);
@@ -88,6 +88,10 @@ private:
                       proto::QrsResponse *response);
     void endGigTrace(sql::QrsSessionSqlResult &result);
     void logSqlPattern(const sql::QrsSessionSqlResult &result);
+    void initResultCacheKey();
+    bool lookupResultCache(sql::QrsSessionSqlResult &result);
+    void putResultCache(const sql::QrsSessionSqlResult &result,
+                        const sql::SqlAccessLogFormatHelper *accessLogHelper);
 
 private:
     inline proto::FormatType convertFormatType(
@@ -103,6 +107,8 @@ private:
     bool isRunGraphError(const ErrorCode errorCode) const;
     bool getResultReadable(const sql::SqlQueryRequest &sqlRequest);
     bool getAllowSoftFailure(const sql::SqlQueryRequest &sqlRequest);    
+    bool getUseResultCache(const sql::SqlQueryRequest &sqlRequest,
+                           const turing::QrsSqlBizPtr &qrsSqlBiz);
 
 protected:
     turing::QrsServiceSnapshotPtr _snapshot;
@@ -125,6 +131,8 @@ private:
     sql::SqlSlowAccessLog *_slowAccessLog = nullptr;
     sql::SqlErrorAccessLog *_errorAccessLog = nullptr;
     bool _useFirstBiz = true;
+    std::string _resultCacheKey;
+    bool _resultFromCache = false;
 private:
     friend class QrsArpcSqlSessionTest;
 
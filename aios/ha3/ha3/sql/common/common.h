@@ -59,6 +59,7 @@ constexpr char SQL_CATALOG_NAME[] = "catalogName";
 constexpr char SQL_DATABASE_NAME[] = "databaseName";
 constexpr char SQL_PREPARE_LEVEL[] = "iquan.plan.prepare.level";
 constexpr char SQL_ENABLE_CACHE[] = "enableSqlCache";
+constexpr char SQL_USE_RESULT_CACHE[] = "useResultCache";
 constexpr char SQL_IQUAN_PLAN_FORMAT_VERSION[] = "iquan.plan.format.version";
 constexpr char SQL_DEFAULT_VALUE_IQUAN_PLAN_FORMAT_VERSION[] = "plan_version_0.0.1";
 constexpr char SQL_IQUAN_OPTIMIZER_TABLE_SUMMARY_SUFFIX[] = "iquan.optimizer.table.summary.suffix";
@@ -83,14 +83,13 @@ void AsyncSummaryLookupCallbackCtx::start(std::vector<docid_t> docIds,
     _terminator.reset(new TimeoutTerminator(timeout));
     if (_asyncPipe->getAsyncPipe() == nullptr) {
         NAVI_LOG(DEBUG, "async pipe is nullptr, use sync await");
-        auto result = future_lite::coro::syncAwait(
-                _summaryReader->GetDocument(_docIds, _poolPtr.get(), _terminator.get(), &_summaryDocVec));
+        auto result = future_lite::coro::syncAwait(getDocument());
         processErrorCodes(result);
         _metricsCollector.lookupTime = incCallbackVersion();
     } else {
         assert(_executor && "executor is nullptr");
         NAVI_LOG(DEBUG, "async pipe ready, use async getDocument");
-        _summaryReader->GetDocument(_docIds, _poolPtr.get(), _terminator.get(), &_summaryDocVec)
+        getDocument()
             .via(_executor)
             .start([ctx = shared_from_this()](
                        future_lite::Try<indexlib::index::ErrorCodeVec> errorCodeTry) {
@@ -99,6 +98,15 @@ void AsyncSummaryLookupCallbackCtx::start(std::vector<docid_t> docIds,
     }
 }
 
+future_lite::coro::Lazy<indexlib::index::ErrorCodeVec> AsyncSummaryLookupCallbackCtx::getDocument() {
+    if (_summaryGroupIdVec.empty()) {
+        return _summaryReader->GetDocument(
+            _docIds, _poolPtr.get(), _terminator.get(), &_summaryDocVec);
+    }
+    return _summaryReader->GetDocument(
+        _docIds, _summaryGroupIdVec, _poolPtr.get(), _terminator.get(), &_summaryDocVec);
+}
+
 void AsyncSummaryLookupCallbackCtx::prepareDocs(std::vector<docid_t> docIds,
                                                 size_t fieldCount) {
     size_t docsCount = docIds.size();
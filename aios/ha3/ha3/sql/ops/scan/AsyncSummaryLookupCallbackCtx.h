@@ -77,6 +77,10 @@ public: // for callback
 
 public: // for kernel && scan
     virtual void start(std::vector<docid_t> docIds, size_t fieldCount, int64_t timeout);
+    // read only these summary groups, empty for all groups
+    void setSummaryGroupIdVec(SummaryGroupIdVec summaryGroupIdVec) {
+        _summaryGroupIdVec = std::move(summaryGroupIdVec);
+    }
     virtual const indexlib::index::SearchSummaryDocVec &getResult() const;
     virtual bool hasError() const;
     std::string getErrorDesc() const;
@@ -85,11 +89,13 @@ public: // for kernel && scan
 
 private:
     void prepareDocs(std::vector<docid_t> docIds, size_t fieldCount);
+    future_lite::coro::Lazy<indexlib::index::ErrorCodeVec> getDocument();
     void processErrorCodes(const indexlib::index::ErrorCodeVec &errorCodes);
 
 private:
     CountedAsyncPipePtr _asyncPipe;
     indexlib::index::SummaryReaderPtr _summaryReader;
+    SummaryGroupIdVec _summaryGroupIdVec;
     std::vector<docid_t> _docIds;
     std::vector<indexlib::document::SearchSummaryDocument> _summaryDocDataVec;
     indexlib::index::SearchSummaryDocVec _summaryDocVec;
@@ -16,6 +16,7 @@
 #include "ha3/sql/ops/scan/DocIdRangesReduceOptimize.h"
 #include "ha3/sql/ops/scan/DocIdRangesReduceOptimize.hpp"
 
+#include <algorithm>
 #include <assert.h>
 #include <ext/alloc_traits.h>
 #include <stdint.h>
@@ -170,11 +171,9 @@ void DocIdRangesReduceOptimize::tryAddKeyRange(
                 RapidJsonHelper::SimpleValue2Str(attr).c_str());
         return;
     }
+    // keep ranges of all attributes, sort keys reduce ordered ranges and
+    // any single value attribute may skip blocks by its zone map
     const string &attrName = SqlJsonUtil::getColumnName(attr);
-    if (std::count(_keyVec.begin(), _keyVec.end(), attrName) == 0) {
-        SQL_LOG(TRACE3, "attr [%s] not found in sort desc", attrName.c_str());
-        return;
-    }
     auto iter = _fieldInfos.find(attrName);
     if (iter == _fieldInfos.end()) {
         SQL_LOG(TRACE3, "attr [%s] not found in field infos", attrName.c_str());
@@ -236,6 +235,23 @@ indexlib::table::DimensionDescriptionVector DocIdRangesReduceOptimize::convertDi
     return dimens;
 }
 
+indexlib::table::DimensionDescriptionVector DocIdRangesReduceOptimize::convertZoneMapDimens(
+        const search::IndexPartitionReaderWrapperPtr &readerPtr) {
+    std::vector<std::string> keys;
+    for (const auto &k2r : _key2keyRange) {
+        // attributes without zone map in any built segment can not reduce ranges, skip per range work
+        if (readerPtr->hasZoneMap(k2r.first)) {
+            keys.push_back(k2r.first);
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+    indexlib::table::DimensionDescriptionVector dimens;
+    for (const auto &key : keys) {
+        dimens.emplace_back(_key2keyRange[key]->convertDimenDescription());
+    }
+    return dimens;
+}
+
 std::string DocIdRangesReduceOptimize::toDebugString(
     const indexlib::table::DimensionDescriptionVector &dimens)
 {
@@ -252,7 +268,12 @@ search::LayerMetaPtr DocIdRangesReduceOptimize::reduceDocIdRange(
         search::IndexPartitionReaderWrapperPtr &readerPtr)
 {
     const indexlib::table::DimensionDescriptionVector &dimens = convertDimens();
-    SQL_LOG(DEBUG, "after convert to dimentions, dimens : %s", toDebugString(dimens).c_str());
+    const indexlib::table::DimensionDescriptionVector &zoneMapDimens = convertZoneMapDimens(readerPtr);
+    SQL_LOG(DEBUG, "after convert to dimentions, dimens : %s, zone map dimens : %s",
+            toDebugString(dimens).c_str(), toDebugString(zoneMapDimens).c_str());
+    if (dimens.empty() && zoneMapDimens.empty()) {
+        return lastRange;
+    }
     search::LayerMetaPtr layerMeta(new search::LayerMeta(pool));
     layerMeta->quota = lastRange->quota;
     layerMeta->maxQuota = lastRange->maxQuota;
@@ -261,19 +282,25 @@ search::LayerMetaPtr DocIdRangesReduceOptimize::reduceDocIdRange(
     layerMeta->quotaType = lastRange->quotaType;
 
     for (size_t i = 0; i < lastRange->size(); ++i) {
-        if ((*lastRange)[i].ordered != search::DocIdRangeMeta::OT_ORDERED) {
-            layerMeta->push_back((*lastRange)[i]);
-            continue;
-        }
         indexlib::DocIdRange rangeLimit((*lastRange)[i].begin, (*lastRange)[i].end + 1);
-        if (rangeLimit.second < rangeLimit.first) {
-            continue;
-        }
         indexlib::DocIdRangeVector resultRanges;
-        if (!readerPtr->getSortedDocIdRanges(
-                        dimens, rangeLimit, resultRanges))
-        {
-            return lastRange;
+        if ((*lastRange)[i].ordered != search::DocIdRangeMeta::OT_ORDERED || dimens.empty()) {
+            // docs not reducible by sort keys can still skip blocks by attribute zone maps
+            if (rangeLimit.second < rangeLimit.first || zoneMapDimens.empty()
+                || !readerPtr->getZoneMapDocIdRanges(zoneMapDimens, rangeLimit, resultRanges))
+            {
+                layerMeta->push_back((*lastRange)[i]);
+                continue;
+            }
+        } else {
+            if (rangeLimit.second < rangeLimit.first) {
+                continue;
+            }
+            if (!readerPtr->getSortedDocIdRanges(
+                            dimens, rangeLimit, resultRanges))
+            {
+                return lastRange;
+            }
         }
         for (size_t j = 0; j < resultRanges.size(); ++j) {
             search::DocIdRangeMeta rangeMeta(
@@ -76,6 +76,8 @@ private:
             const std::string &op,
             const autil::SimpleValue &value);
     indexlib::table::DimensionDescriptionVector convertDimens();
+    indexlib::table::DimensionDescriptionVector
+    convertZoneMapDimens(const search::IndexPartitionReaderWrapperPtr &readerPtr);
     std::string toDebugString(const indexlib::table::DimensionDescriptionVector &dimens);
 private:
     std::vector<std::string> _keyVec;
@@ -160,22 +160,28 @@ bool ScanIteratorCreator::genCreateScanIteratorInfo(
         return false;
     }
     SQL_LOG(DEBUG, "layer meta: %s", layerMeta->toString().c_str());
+    static const std::vector<turing::Ha3SortDesc> emptySortDescs;
+    const std::vector<turing::Ha3SortDesc> *sortDescs = &emptySortDescs;
     if (_tableSortDescription != nullptr) {
         auto iter = _tableSortDescription->find(_tableName);
         if (iter != _tableSortDescription->end()) {
-            SQL_LOG(DEBUG, "begin reduce docid range optimize");
-            DocIdRangesReduceOptimize optimize(iter->second, fieldInfo);
-            if (condition) {
-                condition->accept(&optimize);
-            }
-            layerMeta = optimize.reduceDocIdRange(
-                    layerMeta, _pool, _indexPartitionReaderWrapper);
-            SQL_LOG(DEBUG, "after reduce docid range optimize, layer meta: %s",
-                    layerMeta->toString().c_str());
+            sortDescs = &iter->second;
         } else {
             SQL_LOG(DEBUG, "not find table [%s] sort description", _tableName.c_str());
         }
     }
+    // unsorted tables still reduce docid ranges by attribute zone maps
+    if (condition || !sortDescs->empty()) {
+        SQL_LOG(DEBUG, "begin reduce docid range optimize");
+        DocIdRangesReduceOptimize optimize(*sortDescs, fieldInfo);
+        if (condition) {
+            condition->accept(&optimize);
+        }
+        layerMeta = optimize.reduceDocIdRange(
+                layerMeta, _pool, _indexPartitionReaderWrapper);
+        SQL_LOG(DEBUG, "after reduce docid range optimize, layer meta: %s",
+                layerMeta->toString().c_str());
+    }
     if (layerMeta) {
         layerMeta->quotaMode = QM_PER_DOC;
         proportionalLayerQuota(*layerMeta.get());
@@ -45,7 +45,11 @@
 #include "ha3/sql/ops/util/KernelUtil.h"
 #include "ha3/sql/proto/SqlSearchInfo.pb.h"
 #include "indexlib/index/inverted_index/InvertedIndexReader.h"
+#include "indexlib/config/FieldConfig.h"
+#include "indexlib/config/ITabletSchema.h"
 #include "indexlib/index/normal/summary/summary_reader.h"
+#include "indexlib/index/summary/Common.h"
+#include "indexlib/index/summary/config/SummaryIndexConfig.h"
 #include "indexlib/index_define.h"
 #include "indexlib/partition/index_partition_reader.h"
 #include "indexlib/partition/partition_reader_snapshot.h"
@@ -485,15 +489,67 @@ bool SummaryScan::prepareLookupCtxs() {
             SQL_LOG(ERROR, "can not find summary reader");
             return false;
         }
-        _lookupCtxs.emplace_back(
-            make_shared<AsyncSummaryLookupCallbackCtx>(_countedPipe,
-                                                       summaryReader,
-                                                       _param.scanResource.queryPoolPtr,
-                                                       _param.scanResource.asyncIntraExecutor));
+        auto lookupCtx
+            = make_shared<AsyncSummaryLookupCallbackCtx>(_countedPipe,
+                                                         summaryReader,
+                                                         _param.scanResource.queryPoolPtr,
+                                                         _param.scanResource.asyncIntraExecutor);
+        SummaryGroupIdVec summaryGroupIdVec = genSummaryGroupIdVec(indexPartitionReaderWrapper);
+        SQL_LOG(TRACE2,
+                "lookupCtxs idx[%lu] read summary groups [%s]",
+                _lookupCtxs.size(),
+                StringUtil::toString(summaryGroupIdVec).c_str());
+        lookupCtx->setSummaryGroupIdVec(std::move(summaryGroupIdVec));
+        _lookupCtxs.emplace_back(lookupCtx);
     }
     return true;
 }
 
+SummaryGroupIdVec
+SummaryScan::genSummaryGroupIdVec(const IndexPartitionReaderWrapperPtr &indexPartitionReaderWrapper) {
+    // empty means all groups, it is also the fallback when any used field
+    // can not be mapped to a group of this table.
+    SummaryGroupIdVec summaryGroupIdVec;
+    auto schema = indexPartitionReaderWrapper->getSchema();
+    if (!schema) {
+        return summaryGroupIdVec;
+    }
+    auto indexConfigs = schema->GetIndexConfigs(indexlibv2::index::SUMMARY_INDEX_TYPE_STR);
+    if (indexConfigs.size() != 1u) {
+        return summaryGroupIdVec;
+    }
+    auto summaryIndexConfig
+        = std::dynamic_pointer_cast<indexlibv2::config::SummaryIndexConfig>(indexConfigs[0]);
+    if (!summaryIndexConfig || summaryIndexConfig->IsAllFieldsDisabled()) {
+        return summaryGroupIdVec;
+    }
+    vector<bool> needGroups(summaryIndexConfig->GetSummaryGroupConfigCount(), false);
+    for (const auto &usedField : _usedFields) {
+        if (!_summaryInfo->exist(usedField)) {
+            continue;
+        }
+        auto fieldConfig = schema->GetFieldConfig(usedField);
+        if (!fieldConfig) {
+            return summaryGroupIdVec;
+        }
+        summarygroupid_t groupId
+            = summaryIndexConfig->FieldIdToSummaryGroupId(fieldConfig->GetFieldId());
+        if (groupId < 0 || groupId >= (summarygroupid_t)needGroups.size()) {
+            return summaryGroupIdVec;
+        }
+        needGroups[groupId] = true;
+    }
+    for (size_t i = 0; i < needGroups.size(); ++i) {
+        if (needGroups[i]) {
+            summaryGroupIdVec.push_back((summarygroupid_t)i);
+        }
+    }
+    if (summaryGroupIdVec.size() == needGroups.size()) {
+        summaryGroupIdVec.clear();
+    }
+    return summaryGroupIdVec;
+}
+
 void SummaryScan::startLookupCtxs() {
     _countedPipe->reset();
     size_t fieldCount = _summaryInfo->getFieldCount();
@@ -103,6 +103,8 @@ private:
     bool convertPK2DocId(const std::vector<std::string> &pks);
 
     bool prepareLookupCtxs();
+    SummaryGroupIdVec
+    genSummaryGroupIdVec(const search::IndexPartitionReaderWrapperPtr &indexPartitionReaderWrapper);
     virtual void startLookupCtxs();
     virtual bool getSummaryDocs(SearchSummaryDocVecType &summaryDocs);
     template <typename T>
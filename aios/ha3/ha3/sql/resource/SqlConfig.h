@@ -31,6 +31,7 @@ static const double DEFAULT_SUB_GRAPH_TIMEOUT_FACTOR = 0.9;
 static const uint32_t DEFAULT_SUB_GRAPH_THREAD_LIMIT = 10;
 static const uint32_t DEFAULT_MAIN_GRAPH_THREAD_LIMIT = 5;
 static const std::string DEFAULT_IQUAN_PLAN_PREPARE_LEVEL = "jni.post.optimize";
+static const size_t DEFAULT_RESULT_CACHE_EXPIRE_TIME = 1000; // ms
 
 class SqlConfig : public autil::legacy::Jsonizable {
 public:
@@ -54,6 +55,9 @@ public:
         , needPrintSlowLog(false)
         , needPrintErrorLog(false)
         , enableTurboJet(false)
+        , resultCacheSize(0)
+        , resultCacheExpireTime(DEFAULT_RESULT_CACHE_EXPIRE_TIME)
+        , resultCacheDefaultEnable(false)
     {}
 
     ~SqlConfig() {}
@@ -92,6 +96,10 @@ public:
         needPrintSlowLog = slowQueryFactory > 0.0;
         json.Jsonize("need_print_error_log", needPrintErrorLog, needPrintErrorLog);
         json.Jsonize("enable_turbojet", enableTurboJet, enableTurboJet);
+        json.Jsonize("result_cache_size", resultCacheSize, resultCacheSize);
+        json.Jsonize("result_cache_expire_time", resultCacheExpireTime, resultCacheExpireTime);
+        json.Jsonize(
+            "result_cache_default_enable", resultCacheDefaultEnable, resultCacheDefaultEnable);
         std::map<std::string, std::vector<std::string>> dbNameAliasMap;
         json.Jsonize("db_name_alias", dbNameAliasMap, dbNameAliasMap);
         for (const auto &pair : dbNameAliasMap) {
@@ -132,6 +140,9 @@ public:
     bool needPrintSlowLog;
     bool needPrintErrorLog;
     bool enableTurboJet;
+    size_t resultCacheSize; // MB, 0 means disabled
+    size_t resultCacheExpireTime; // ms
+    bool resultCacheDefaultEnable;
     std::map<std::string, std::string> dbNameAlias;
     std::map<std::string, std::vector<std::string>> tableNameAlias;
 };
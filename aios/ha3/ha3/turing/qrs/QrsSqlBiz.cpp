@@ -27,6 +27,8 @@
 #include "access_log/local/LocalAccessLogReader.h"
 #endif
 #include "aios/network/gig/multi_call/interface/SearchService.h"
+#include "autil/HashAlgorithm.h"
+#include "autil/StringUtil.h"
 #include "build_service/analyzer/AnalyzerFactory.h"
 #include "ha3/config/AnomalyProcessConfig.h"
 #include "ha3/config/QrsConfig.h"
@@ -560,6 +562,7 @@ tensorflow::Status QrsSqlBiz::loadUserPlugins() {
     if (!initSqlAuthManager(_sqlConfigPtr->authenticationConfig)) {
         return errors::Internal("init sql authentication manager failed");
     }
+    initSqlResultCache(_sqlConfigPtr->sqlConfig);
 
     return Status::OK();
 }
@@ -581,6 +584,19 @@ bool QrsSqlBiz::initSqlAuthManager(const isearch::sql::AuthenticationConfig &aut
     return true;
 }
 
+void QrsSqlBiz::initSqlResultCache(const isearch::sql::SqlConfig &sqlConfig) {
+    if (sqlConfig.resultCacheSize == 0) {
+        SQL_LOG(INFO, "sql result cache disabled");
+        return;
+    }
+    // the cache lives with the biz, so a biz or config reload drops all
+    // cached results together with the old biz.
+    _sqlResultCache.reset(new SqlResultCache(sqlConfig.resultCacheSize * 1024 * 1024,
+                                             sqlConfig.resultCacheExpireTime * 1000));
+    SQL_LOG(INFO, "init sql result cache, size [%lu] MB, expire time [%lu] ms",
+            sqlConfig.resultCacheSize, sqlConfig.resultCacheExpireTime);
+}
+
 size_t QrsSqlBiz::getSinglePoolUsageLimit() const {
     // convert MB to B
     return (size_t)_workerParam.singlePoolUsageLimit * 1024 * 1024;
@@ -590,5 +606,30 @@ isearch::sql::SqlAuthManager *QrsSqlBiz::getSqlAuthManager() const {
     return _sqlAuthManager.get();
 }
 
+SqlResultCache *QrsSqlBiz::getSqlResultCache() const {
+    return _sqlResultCache.get();
+}
+
+int64_t QrsSqlBiz::getSearcherDataVersion() const {
+    if (!_searchService) {
+        return 0;
+    }
+    auto bizNames = _searchService->getBizNames();
+    std::sort(bizNames.begin(), bizNames.end());
+    string versionStr;
+    for (const auto &bizName : bizNames) {
+        // bizs in rolling switch publish both versions, the key differs from either side
+        auto versions = _searchService->getBizVersion(bizName);
+        std::sort(versions.begin(), versions.end());
+        versionStr += bizName;
+        for (auto version : versions) {
+            versionStr.push_back(':');
+            versionStr += autil::StringUtil::toString(version);
+        }
+        versionStr.push_back(';');
+    }
+    return (int64_t)autil::HashAlgorithm::hashString64(versionStr.c_str(), versionStr.size());
+}
+
 } // namespace turing
 } // namespace isearch
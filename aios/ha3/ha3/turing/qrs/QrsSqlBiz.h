@@ -18,6 +18,7 @@
 #include "ha3/monitor/QrsBizMetrics.h"
 #include "ha3/turing/common/SqlBiz.h"
 #include "ha3/sql/resource/MessageWriterManager.h"
+#include "ha3/turing/qrs/SqlResultCache.h"
 
 namespace isearch {
 namespace turing {
@@ -59,6 +60,10 @@ public:
                     std::map<std::string, isearch::turing::ModelConfig> *modelConfigMap);
     size_t getSinglePoolUsageLimit() const;
     isearch::sql::SqlAuthManager *getSqlAuthManager() const;
+    SqlResultCache *getSqlResultCache() const;
+    // hash of the versions of all bizs in search service, changes when a searcher
+    // switches full index or config, see Ha3BizBase::calcVersion
+    int64_t getSearcherDataVersion() const;
 
 protected:
     suez::turing::QueryResourcePtr createQueryResource() override;
@@ -80,11 +85,13 @@ private:
     tensorflow::Status fillExternalTableModels(iquan::TableModels &tableModels);
     suez::turing::BizInfo getBizInfoWithJoinInfo(const std::string &bizName);
     bool initSqlAuthManager(const isearch::sql::AuthenticationConfig &authenticationConfig);
+    void initSqlResultCache(const isearch::sql::SqlConfig &sqlConfig);
 private:
     monitor::Ha3BizMetricsPtr _bizMetrics;
     std::string _defaultCatalogName;
     std::string _defaultDatabaseName;
     std::shared_ptr<isearch::sql::SqlAuthManager> _sqlAuthManager;
+    SqlResultCachePtr _sqlResultCache;
 
 private:
     AUTIL_LOG_DECLARE();
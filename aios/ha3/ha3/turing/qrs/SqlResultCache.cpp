@@ -0,0 +1,103 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ha3/turing/qrs/SqlResultCache.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "autil/StringUtil.h"
+#include "ha3/sql/common/common.h"
+#include "ha3/sql/data/SqlQueryRequest.h"
+
+using namespace std;
+using namespace autil;
+
+namespace isearch {
+namespace turing {
+AUTIL_LOG_SETUP(ha3, SqlResultCache);
+
+SqlResultCache::SqlResultCache(size_t memSizeLimit, int64_t expireTimeInUs)
+    : _lruCache(memSizeLimit)
+    , _expireTimeInUs(expireTimeInUs)
+{
+}
+
+SqlResultCache::~SqlResultCache() {
+}
+
+bool SqlResultCache::get(const string &key, int64_t currentTime, string &value) {
+    ResultItem item;
+    if (!_lruCache.get(key, item, [currentTime](const ResultItem &cached) {
+            return cached.expireTime > currentTime;
+        }))
+    {
+        return false;
+    }
+    value = std::move(item.value);
+    return true;
+}
+
+void SqlResultCache::put(const string &key, int64_t currentTime, string value) {
+    size_t valueMemUse = value.size();
+    _lruCache.put(key, ResultItem{std::move(value), currentTime + _expireTimeInUs}, valueMemUse);
+}
+
+void SqlResultCache::clear() {
+    _lruCache.clear();
+}
+
+string SqlResultCache::genCacheKey(const string &bizName,
+                                   int64_t dataVersion,
+                                   const sql::SqlQueryRequest &request) {
+    // params only affecting session control or result formatting are left
+    // out, the cached value is the result table before formatting.
+    static const vector<string> ignoreParams = {
+        sql::SQL_TIMEOUT,
+        sql::SQL_FORMAT_TYPE,
+        sql::SQL_FORMAT_TYPE_NEW,
+        sql::SQL_FORMAT_DESC,
+        sql::SQL_RESULT_READABLE,
+        sql::SQL_RESULT_ALLOW_SOFT_FAILURE,
+        sql::SQL_GET_RESULT_COMPRESS_TYPE,
+        sql::SQL_USE_RESULT_CACHE,
+    };
+    const auto &kvPair = request.getSqlParams();
+    vector<pair<string, string>> params;
+    params.reserve(kvPair.size());
+    for (const auto &kv : kvPair) {
+        if (find(ignoreParams.begin(), ignoreParams.end(), kv.first) != ignoreParams.end()) {
+            continue;
+        }
+        params.emplace_back(kv.first, kv.second);
+    }
+    sort(params.begin(), params.end());
+    string key = bizName;
+    key.push_back('\0');
+    key += StringUtil::toString(dataVersion);
+    key.push_back('\0');
+    key += request.getSqlQuery();
+    for (const auto &param : params) {
+        key.push_back('\0');
+        key += param.first;
+        key.push_back(sql::SQL_KV_SPLIT);
+        key += param.second;
+    }
+    return key;
+}
+
+} // namespace turing
+} // namespace isearch
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+#include "autil/Log.h" // IWYU pragma: keep
+#include "ha3/util/SlicedLruCache.h"
+
+namespace isearch {
+namespace sql {
+class SqlQueryRequest;
+} // namespace sql
+} // namespace isearch
+
+namespace isearch {
+namespace turing {
+
+// result cache for sql queries, stores serialized result tables keyed by
+// biz name, searcher data version, sql string and normalized kv params.
+// a full index or config switch of any searcher changes the data version, so
+// results of old tables are never hit again. inc and realtime updates within
+// a version are bounded by ttl. entries are evicted in lru order when the
+// memory budget of the slice is exceeded.
+class SqlResultCache {
+public:
+    SqlResultCache(size_t memSizeLimit, int64_t expireTimeInUs);
+    ~SqlResultCache();
+
+private:
+    SqlResultCache(const SqlResultCache &);
+    SqlResultCache &operator=(const SqlResultCache &);
+
+public:
+    bool get(const std::string &key, int64_t currentTime, std::string &value);
+    void put(const std::string &key, int64_t currentTime, std::string value);
+    void clear();
+    size_t getMemUse() const {
+        return _lruCache.getMemUse();
+    }
+    size_t getItemCount() const {
+        return _lruCache.getItemCount();
+    }
+
+public:
+    static std::string genCacheKey(const std::string &bizName,
+                                   int64_t dataVersion,
+                                   const sql::SqlQueryRequest &request);
+
+private:
+    struct ResultItem {
+        std::string value;
+        int64_t expireTime;
+    };
+
+private:
+    util::SlicedLruCache<ResultItem> _lruCache;
+    int64_t _expireTimeInUs;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+typedef std::shared_ptr<SqlResultCache> SqlResultCachePtr;
+
+} // namespace turing
+} // namespace isearch
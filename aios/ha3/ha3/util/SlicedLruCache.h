@@ -0,0 +1,175 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <iterator>
+#include <list>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "autil/HashAlgorithm.h"
+#include "autil/Lock.h"
+#include "autil/Log.h" // IWYU pragma: keep
+
+namespace isearch {
+namespace util {
+
+// memory bounded lru cache keyed by string. keys are hashed to slices, each
+// slice has its own lock, lru list and memory budget. memory use and item
+// count are kept in atomic counters, reading them takes no slice lock.
+template <typename V>
+class SlicedLruCache {
+public:
+    explicit SlicedLruCache(size_t memSizeLimit)
+        : _sliceMemSizeLimit(memSizeLimit / SLICE_SIZE)
+        , _memUse(0)
+        , _itemCount(0) {}
+    ~SlicedLruCache() {}
+
+private:
+    SlicedLruCache(const SlicedLruCache &);
+    SlicedLruCache &operator=(const SlicedLruCache &);
+
+public:
+    // an item failing isValid(value) is erased and counted as a miss
+    template <typename Validator>
+    bool get(const std::string &key, V &value, Validator &&isValid);
+    bool get(const std::string &key, V &value) {
+        return get(key, value, [](const V &) { return true; });
+    }
+    // valueMemUse is the memory held by value out of the item, return false
+    // if the item can not fit in one slice
+    bool put(const std::string &key, V value, size_t valueMemUse);
+    void clear();
+    size_t getMemUse() const {
+        return _memUse.load(std::memory_order_relaxed);
+    }
+    size_t getItemCount() const {
+        return _itemCount.load(std::memory_order_relaxed);
+    }
+    size_t getSliceMemSizeLimit() const {
+        return _sliceMemSizeLimit;
+    }
+
+private:
+    struct CacheItem {
+        std::string key;
+        V value;
+        size_t memUse;
+    };
+    typedef std::list<CacheItem> CacheList;
+    struct CacheSlice {
+        autil::ThreadMutex mutex;
+        CacheList lruList;
+        std::unordered_map<std::string, typename CacheList::iterator> itemMap;
+        size_t memUse = 0;
+    };
+
+private:
+    CacheSlice &getSlice(const std::string &key) {
+        uint64_t hashKey = autil::HashAlgorithm::hashString64(key.c_str(), key.size());
+        return _slices[hashKey % SLICE_SIZE];
+    }
+    void eraseItem(CacheSlice &slice, typename CacheList::iterator iter);
+
+private:
+    static const size_t SLICE_SIZE = 16;
+    CacheSlice _slices[SLICE_SIZE];
+    size_t _sliceMemSizeLimit;
+    std::atomic<size_t> _memUse;
+    std::atomic<size_t> _itemCount;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+AUTIL_LOG_SETUP_TEMPLATE(ha3, SlicedLruCache, V);
+
+template <typename V>
+template <typename Validator>
+inline bool SlicedLruCache<V>::get(const std::string &key, V &value, Validator &&isValid) {
+    auto &slice = getSlice(key);
+    autil::ScopedLock lock(slice.mutex);
+    auto it = slice.itemMap.find(key);
+    if (it == slice.itemMap.end()) {
+        return false;
+    }
+    auto listIter = it->second;
+    if (!isValid(listIter->value)) {
+        eraseItem(slice, listIter);
+        return false;
+    }
+    slice.lruList.splice(slice.lruList.begin(), slice.lruList, listIter);
+    value = listIter->value;
+    return true;
+}
+
+template <typename V>
+inline bool SlicedLruCache<V>::put(const std::string &key, V value, size_t valueMemUse) {
+    // the key is held by both the list item and the map
+    size_t itemMemUse = sizeof(CacheItem) + key.size() * 2 + valueMemUse;
+    if (itemMemUse > _sliceMemSizeLimit) {
+        AUTIL_LOG(DEBUG,
+                  "item size [%lu] exceeds cache slice limit [%lu], skip",
+                  itemMemUse,
+                  _sliceMemSizeLimit);
+        return false;
+    }
+    auto &slice = getSlice(key);
+    autil::ScopedLock lock(slice.mutex);
+    auto it = slice.itemMap.find(key);
+    if (it != slice.itemMap.end()) {
+        eraseItem(slice, it->second);
+    }
+    while (!slice.lruList.empty() && slice.memUse + itemMemUse > _sliceMemSizeLimit) {
+        eraseItem(slice, std::prev(slice.lruList.end()));
+    }
+    slice.lruList.push_front(CacheItem{key, std::move(value), itemMemUse});
+    slice.itemMap[key] = slice.lruList.begin();
+    slice.memUse += itemMemUse;
+    _memUse.fetch_add(itemMemUse, std::memory_order_relaxed);
+    _itemCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename V>
+inline void SlicedLruCache<V>::clear() {
+    for (size_t i = 0; i < SLICE_SIZE; ++i) {
+        auto &slice = _slices[i];
+        autil::ScopedLock lock(slice.mutex);
+        _memUse.fetch_sub(slice.memUse, std::memory_order_relaxed);
+        _itemCount.fetch_sub(slice.itemMap.size(), std::memory_order_relaxed);
+        slice.itemMap.clear();
+        slice.lruList.clear();
+        slice.memUse = 0;
+    }
+}
+
+template <typename V>
+inline void SlicedLruCache<V>::eraseItem(CacheSlice &slice, typename CacheList::iterator iter) {
+    slice.memUse -= iter->memUse;
+    _memUse.fetch_sub(iter->memUse, std::memory_order_relaxed);
+    _itemCount.fetch_sub(1, std::memory_order_relaxed);
+    slice.itemMap.erase(iter->key);
+    slice.lruList.erase(iter);
+}
+
+} // namespace util
+} // namespace isearch
@@ -53,6 +53,7 @@ IOComponent::IOComponent(Transport *owner, Socket *socket) {
     _isSocketInEpoll = false;
     _type = IOC_BASE;
     _belongedWorker = NULL;
+    _workerHint = -1;
 }
 
 /*
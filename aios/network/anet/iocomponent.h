@@ -279,6 +279,17 @@ public:
         return _type;
     }
 
+    /**
+     * pin this component to the ioworker with given index,
+     * should be set before init(). -1 means hashing by fd
+     */
+    void setWorkerHint(int workerHint) {
+        _workerHint = workerHint;
+    }
+    int getWorkerHint() const {
+        return _workerHint;
+    }
+
 protected:
     /**
      * Transport distribute ioworker based on socket fd
@@ -306,6 +317,7 @@ protected:
     ThreadMutex _socketMutex;
     IocType _type;
     IoWorker *_belongedWorker;
+    int _workerHint;
 private:
     IOComponent *_prev; // 用于链表
     IOComponent *_next; // 用于链表
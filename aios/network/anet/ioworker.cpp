@@ -83,6 +83,13 @@ void IoWorker::run(Thread *thread, void *arg) {
         thread->setPriority(1, SCHED_RR);
     }
     setPriorityByEnv();
+    if (_cpuAffinity >= 0) {
+        if (thread->setAffinity(_cpuAffinity)) {
+            ANET_LOG(INFO, "bind anet io worker to cpu %d success.", _cpuAffinity);
+        } else {
+            ANET_LOG(WARN, "bind anet io worker to cpu %d failed.", _cpuAffinity);
+        }
+    }
     eventLoop();
 }
 
@@ -283,4 +290,8 @@ void IoWorker::setName(const char *name) {
     _ioThread.setName(name);
 }
 
+void IoWorker::setCpuAffinity(int cpu) {
+    _cpuAffinity = cpu;
+}
+
 } // namespace anet
@@ -104,6 +104,11 @@ public:
     void getTcpConnStats(std::vector<ConnStat> &connStats);
 
     void setName(const char *name);
+
+    /**
+     * bind the io thread to @param cpu when it starts, -1 means no binding
+     */
+    void setCpuAffinity(int cpu);
 private:
     /**
      * process Command in queue _commands;
@@ -124,6 +129,7 @@ private:
     IOComponent *_iocListHead, *_iocListTail;   // IOComponent list
     std::vector<Transport::TransportCommand> _commands;
     int _epollWaitTimeoutMs{100};
+    int _cpuAffinity{-1};
 public:
     static __thread int64_t _loopTime;
 };
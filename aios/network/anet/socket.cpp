@@ -45,6 +45,8 @@ Socket::Socket(int family) {
     _socketHandle = -1;
     _iocomponent = NULL;
     _qosId = 0;
+    _reusePort = false;
+    _reusePortOwner = false;
     addr.setProtocolFamily(family);
     addr.setProtocolType((int)SOCK_STREAM);
     clearCnt();
@@ -565,6 +567,17 @@ bool Socket::listen(int backlog) {
     }
 
     setReuseAddress(true);
+    if (_reusePort) {
+        if (_reusePortOwner && !checkAddressFree()) {
+            return false;
+        }
+        if (!setIntOption(SO_REUSEPORT, 1)) {
+            int error = getLastError();
+            ERRSTR(error);
+            ANET_LOG(ERROR, "set SO_REUSEPORT failed, %s(%d)", errStr, error);
+            return false;
+        }
+    }
 
     if (addr.getProtocolFamily() == AF_UNIX){
         /* special logic for unix domain socket. 
@@ -634,6 +647,41 @@ bool Socket::bindLocalAddress(const char *localIp, uint16_t localPort) {
     return true;
 }
 
+bool Socket::checkAddressFree() {
+    /* SO_REUSEPORT silently joins any listener of the same user on the
+     * port, so probe with a plain bind first: it fails if the port is
+     * already listened on by anybody else. */
+    int probeHandle = ::socket(addr.getProtocolFamily(), SOCK_STREAM, 0);
+    if (probeHandle < 0) {
+        int error = getLastError();
+        ERRSTR(error);
+        ANET_LOG(ERROR, "create probe socket failed, %s(%d)", errStr, error);
+        return false;
+    }
+    int on = 1;
+    ::setsockopt(probeHandle, SOL_SOCKET, SO_REUSEADDR, (const void *)&on, sizeof(on));
+    bool ret = true;
+    if (::bind(probeHandle, addr.getAddr(), addr.getAddrSize()) < 0) {
+        int error = getLastError();
+        ERRSTR(error);
+        ANET_LOG(ERROR, "address is owned by another socket, refuse to share it "
+                 "with SO_REUSEPORT, %s(%d)", errStr, error);
+        bindErrInc();
+        ret = false;
+    }
+    ::close(probeHandle);
+    return ret;
+}
+
+bool Socket::copyListenAddress(Socket *listenSocket) {
+    sockaddr_in address;
+    if (!listenSocket->getSockAddr(address, true)) {
+        return false;
+    }
+    addr.setInetAddr((int)SOCK_STREAM, &address);
+    return true;
+}
+
 int Socket::getProtocolFamily() {
     return addr.getProtocolFamily();
 }
@@ -83,6 +83,18 @@ public:
         return setIntOption(SO_REUSEADDR, on ? 1 : 0);
     }
 
+    /* set SO_REUSEPORT in listen(), so several sockets can share one port.
+     * the owner checks in listen() that nobody else holds the port yet,
+     * the others then join the owner's port */
+    void setReusePort(bool on, bool owner = false) {
+        _reusePort = on;
+        _reusePortOwner = on && owner;
+    }
+
+    /* use the bound address of a listening socket, needed when it
+     * listens on port 0 */
+    bool copyListenAddress(Socket *listenSocket);
+
     bool setSoLinger (bool doLinger, int seconds);
 
     bool setTcpNoDelay(bool noDelay);
@@ -160,6 +172,8 @@ protected:
     IOComponent *_iocomponent;
     AddrSpec addr;
     std::string _addrSpec;
+    bool _reusePort;
+    bool _reusePortOwner;
 
 private:
     atomic64_t _bindErrCnt;
@@ -171,6 +185,7 @@ private:
     static atomic64_t _globalAcceptConnCnt;
 
     int rebindconn();
+    bool checkAddressFree();
     void clearCnt();
     void bindErrInc(){atomic_inc(&_bindErrCnt);}
     void connectErrInc(){atomic_inc(&_connectErrCnt);}
@@ -75,6 +75,8 @@ bool TCPAcceptor::handleReadEvent() {
         ANET_LOG(DEBUG, "New connection coming. fd=%d", socket->getSocketHandle());
         TCPComponent *component = new TCPComponent(_owner, socket);
         assert(component);
+        // keep connections accepted by a reuse port acceptor on its ioworker
+        component->setWorkerHint(_workerHint);
         component->setMaxIdleTime(_maxIdleTimeInMillseconds);
         if (!component->init(true)) {
             delete component;/**@TODO: may coredump?*/
@@ -102,12 +104,24 @@ bool TCPAcceptor::handleErrorEvent() {
 }
 
 void TCPAcceptor::close() {
+    std::vector<TCPAcceptor*> reusePortAcceptors;
     lock();
     if (getState() != ANET_CLOSED) {
         closeSocketNoLock();
         setState(ANET_CLOSED);
     }
     _belongedWorker->postCommand(Transport::TC_REMOVE_IOC, this);
+    reusePortAcceptors.swap(_reusePortAcceptors);
+    unlock();
+    for (size_t i = 0; i < reusePortAcceptors.size(); i++) {
+        reusePortAcceptors[i]->close();
+        reusePortAcceptors[i]->subRef();
+    }
+}
+
+void TCPAcceptor::addReusePortAcceptor(TCPAcceptor *acceptor) {
+    lock();
+    _reusePortAcceptors.push_back(acceptor);
     unlock();
 }
 
@@ -17,6 +17,7 @@
 #define ANET_TCPACCEPTOR_H_
 #include <stdint.h>
 #include <ostream>
+#include <vector>
 
 #include "aios/network/anet/iocomponent.h"
 
@@ -56,8 +57,15 @@ public:
         buf << "Max Idle Time: " << _maxIdleTimeInMillseconds << "ms" << std::endl;
         buf << "Queue Timeout: " << _timeout << "ms" << std::endl;
         buf << "Backlog: " << _backlog << std::endl;
+        buf << "Reuse Port Acceptors: " << _reusePortAcceptors.size() << std::endl;
     }
 
+    /**
+     * acceptors listening on the same port with SO_REUSEPORT, one per
+     * ioworker. They are closed together with this acceptor.
+     */
+    void addReusePortAcceptor(TCPAcceptor *acceptor);
+
     /* for UT purpose */
     IOComponent *getLastAcceptedComponent() {
         return _lastAcceptedComponent;
@@ -69,6 +77,7 @@ private:
     int _timeout;
     int _maxIdleTimeInMillseconds;
     int _backlog;
+    std::vector<TCPAcceptor*> _reusePortAcceptors;
 
     /* for testing purpose */
     IOComponent *_lastAcceptedComponent;
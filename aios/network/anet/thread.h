@@ -87,6 +87,17 @@ namespace anet {
       return true;
     }
 
+    /**
+     * bind this thread to a single cpu
+     * @return return true if success.
+     **/
+    bool setAffinity(int cpu) {
+      cpu_set_t cpuSet;
+      CPU_ZERO(&cpuSet);
+      CPU_SET(cpu, &cpuSet);
+      return pthread_setaffinity_np(tid, sizeof(cpuSet), &cpuSet) == 0;
+    }
+
     /**
      * 得到回调参数
      * 
@@ -23,6 +23,7 @@
 #include "aios/network/anet/transportlist.h"
 #include "aios/network/anet/ioworker.h"
 #include <assert.h>
+#include <sched.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -39,6 +40,7 @@
 #include "aios/network/anet/iocomponent.h"
 #include "aios/network/anet/thread.h"
 #include "aios/network/anet/threadmutex.h"
+#include "autil/EnvUtil.h"
 
 namespace anet {
 class Connection;
@@ -51,7 +53,21 @@ using namespace std;
 namespace anet {
 
 namespace {
-    const int MAX_IO_THREAD_NUM = 8;
+    const int MAX_IO_THREAD_NUM = 32;
+
+    /* cpus this process may run on, respects cpuset and taskset limits */
+    void getAllowedCpus(std::vector<int> &cpus) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+            return;
+        }
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &cpuSet)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
 } // anonymous namespace
 
 static int SimpleHashStrategy(int fd, int ioThreadNum) {
@@ -96,6 +112,8 @@ void Transport::initialize() {
     _stop = false;
     _started = false;
     _promotePriority = false;
+    _reusePortListen = autil::EnvUtil::getEnv("ANET_REUSE_PORT_LISTEN", false);
+    _bindIoThreadCpu = autil::EnvUtil::getEnv("ANET_IO_THREAD_BIND_CPU", false);
     _nextCheckTime = 0;
     _timeoutLoopInterval = 100000; //default 100ms
     /* Register the object into the global list. */
@@ -121,7 +139,14 @@ bool Transport::start(bool promotePriority) {
     _started = true;
     _promotePriority = promotePriority;
     signal(SIGPIPE, SIG_IGN);
+    std::vector<int> cpus;
+    if (_bindIoThreadCpu) {
+        getAllowedCpus(cpus);
+    }
     for (int k = 0; k < _ioThreadNum + _listenThreadNum; ++k) {
+        if (!cpus.empty()) {
+            _ioWorkers[k].setCpuAffinity(cpus[k % cpus.size()]);
+        }
         _ioWorkers[k].start(_promotePriority);
     }
     _timeoutThread.start(this, NULL);
@@ -278,14 +303,27 @@ IOComponent *Transport::listen (const char *spec, IPacketStreamer *streamer,
     socket->setAddrSpec(spec);
     if (socket->getProtocolType() == (int)SOCK_STREAM)
     {
+        bool reusePort = _reusePortListen && _ioThreadNum > 1
+                         && _listenFdThreadMode == SHARE_THREAD
+                         && socket->getProtocolFamily() == AF_INET;
+        if (reusePort) {
+            socket->setReusePort(true, true);
+        }
         // TCPAcceptor
         TCPAcceptor *acceptor = new TCPAcceptor(this, socket, 
                 streamer, serverAdapter, postPacketTimeout, maxIdleTime, backlog);
         DBGASSERT(acceptor);
+        if (reusePort) {
+            acceptor->setWorkerHint(0);
+        }
         if (!acceptor->init()) {
             delete acceptor;
             return NULL;
         }
+        if (reusePort) {
+            addReusePortAcceptors(acceptor, streamer, serverAdapter,
+                                  postPacketTimeout, maxIdleTime, backlog);
+        }
         return acceptor;
     } else {
         ANET_LOG(WARN, "SOCK_DGRAM server does not support yet, spec %s", spec);
@@ -295,6 +333,34 @@ IOComponent *Transport::listen (const char *spec, IPacketStreamer *streamer,
     return NULL;
 }
 
+void Transport::addReusePortAcceptors(TCPAcceptor *acceptor,
+                                      IPacketStreamer *streamer,
+                                      IServerAdapter *serverAdapter,
+                                      int postPacketTimeout,
+                                      int maxIdleTime, int backlog)
+{
+    for (int k = 1; k < _ioThreadNum; ++k) {
+        Socket *socket = new Socket();
+        DBGASSERT(socket);
+        // use the bound address, the spec may listen on port 0
+        if (!socket->copyListenAddress(acceptor->getSocket())) {
+            delete socket;
+            break;
+        }
+        socket->setReusePort(true);
+        TCPAcceptor *reusePortAcceptor = new TCPAcceptor(this, socket,
+                streamer, serverAdapter, postPacketTimeout, maxIdleTime, backlog);
+        DBGASSERT(reusePortAcceptor);
+        reusePortAcceptor->setWorkerHint(k);
+        if (!reusePortAcceptor->init()) {
+            ANET_LOG(WARN, "init reuse port acceptor for io thread %d failed", k);
+            delete reusePortAcceptor;
+            break;
+        }
+        acceptor->addReusePortAcceptor(reusePortAcceptor);
+    }
+}
+
 Connection *Transport::connect(const char *spec, 
                                IPacketStreamer *streamer, 
                                bool autoReconn,
@@ -335,6 +401,9 @@ int Transport::getChunkId(const IOComponent *ioc) const {
     }
     else
     {
+        if (ioc->getWorkerHint() >= 0) {
+            return ioc->getWorkerHint() % _ioThreadNum;
+        }
         IOComponent *pioc = const_cast<IOComponent*>(ioc);
         return SimpleHashStrategy(pioc->getSocket()->getSocketHandle(), _ioThreadNum);
     }
@@ -366,6 +435,14 @@ void Transport::setName(const std::string &name) {
     _name = name;
 }
 
+void Transport::setReusePortListen(bool enable) {
+    _reusePortListen = enable;
+}
+
+void Transport::setBindIoThreadCpu(bool enable) {
+    _bindIoThreadCpu = enable;
+}
+
 Connection *Transport::connectWithAddr(const char *localAddr, const char *remoteSpec, 
                                        IPacketStreamer *streamer, bool autoReconn, CONNPRIORITY prio) 
 {
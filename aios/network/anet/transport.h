@@ -39,6 +39,7 @@
 namespace anet {
 
 class IoWorker;
+class TCPAcceptor;
 
 /**
  * This class controls behavior of ANET. There are two work modes: 
@@ -243,6 +244,23 @@ public:
     void setName(const std::string &name);
     const std::string& getName() const {return _name;}
 
+    /**
+     * listen tcp address with one SO_REUSEPORT acceptor per io thread,
+     * so the kernel spreads new connections over all io threads and
+     * each connection stays on the thread accepted it. Only works in
+     * SHARE_THREAD mode, should be set before listen(). listen() fails
+     * if another socket already listens on the address.
+     * Default value comes from env ANET_REUSE_PORT_LISTEN.
+     */
+    void setReusePortListen(bool enable);
+
+    /**
+     * bind io thread k to the k-th (mod count) cpu this process is allowed
+     * to run on, should be set before start().
+     * Default value comes from env ANET_IO_THREAD_BIND_CPU.
+     */
+    void setBindIoThreadCpu(bool enable);
+
 protected:
 /**
  * parse [upd|tcp]:ip:port address
@@ -266,6 +284,11 @@ protected:
 
 private:
     void initialize();
+    void addReusePortAcceptors(TCPAcceptor *acceptor,
+                               IPacketStreamer *streamer,
+                               IServerAdapter *serverAdapter,
+                               int postPacketTimeout,
+                               int maxIdleTime, int backlog);
 
     /**
      * getChunkId determines which IoWorker instance is response for handling
@@ -288,6 +311,8 @@ private:
     bool _stop;              // stopping flag
     bool _started;
     bool _promotePriority;
+    bool _reusePortListen;
+    bool _bindIoThreadCpu;
     int64_t _nextCheckTime; 
     int64_t _timeoutLoopInterval;
 
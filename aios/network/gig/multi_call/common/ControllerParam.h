@@ -69,6 +69,10 @@ constexpr float ERROR_RATIO_TOLERANCE = 10.0f;
 
 constexpr float FACTOR_US_TO_MS = 1000.0f;
 
+// power of two choices selection
+constexpr float EWMA_LATENCY_ALPHA = 0.3f;
+constexpr float EWMA_LATENCY_MIN_MS = 0.1f;
+
 constexpr float INVALID_FLOAT_OUTPUT_VALUE = -1.0f;
 
 constexpr size_t MAX_BEST_CHAIN_QUEUE_SIZE = 10u;
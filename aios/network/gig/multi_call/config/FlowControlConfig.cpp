@@ -27,6 +27,9 @@ void FlowControlConfig::validate() {
     errorRatioLimit = getValidPercent(errorRatioLimit, "error_limit_ratio");
     etTriggerPercent = getValidPercent(etTriggerPercent, "et percent");
     retryTriggerPercent = getValidPercent(retryTriggerPercent, "retry percent");
+    retryBudgetPercent = getValidPercent(retryBudgetPercent, "retry budget percent");
+    retryLatencyPercentile =
+        getValidPercent(retryLatencyPercentile, "retry latency percentile");
     latencyTimeWindowSize =
         getValidInteger(latencyTimeWindowSize, "window_size");
     if (beginServerDegradeLatency > beginDegradeLatency) {
@@ -79,9 +82,12 @@ bool FlowControlConfig::operator==(const FlowControlConfig &rhs) const {
            etMinWaitTime == rhs.etMinWaitTime &&
            retryTriggerPercent == rhs.retryTriggerPercent &&
            retryWaitTimeFactor == rhs.retryWaitTimeFactor &&
+           retryBudgetPercent == rhs.retryBudgetPercent &&
+           retryLatencyPercentile == rhs.retryLatencyPercentile &&
            beginServerDegradeErrorRatio == rhs.beginServerDegradeErrorRatio &&
            beginDegradeErrorRatio == rhs.beginDegradeErrorRatio &&
-           fullDegradeErrorRatio == rhs.fullDegradeErrorRatio;
+           fullDegradeErrorRatio == rhs.fullDegradeErrorRatio &&
+           powerOfTwoChoices == rhs.powerOfTwoChoices;
 }
 
 } // namespace multi_call
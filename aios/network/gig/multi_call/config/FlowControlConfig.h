@@ -37,10 +37,12 @@ public:
           retryWaitTimeFactor(DEFAULT_WAIT_TIME_FACTOR), retryMinWaitTime(0),
           retryMinProviderWeight(0),
           retryLimitPerSecond(DEFAULT_RETRY_LIMIT_PER_SECOND),
+          retryBudgetPercent(MAX_PERCENT), retryLatencyPercentile(0.0f),
           latencyTimeWindowSize(DEFAULT_LATENCY_TIME_WINDOW_SIZE),
           beginServerDegradeErrorRatio(MAX_PERCENT),
           beginDegradeErrorRatio(MAX_PERCENT),
-          fullDegradeErrorRatio(MAX_PERCENT), minWeight(MIN_WEIGHT_FLOAT) {}
+          fullDegradeErrorRatio(MAX_PERCENT), minWeight(MIN_WEIGHT_FLOAT),
+          powerOfTwoChoices(false) {}
     ~FlowControlConfig() {}
 
 public:
@@ -70,6 +72,10 @@ public:
                      retryMinProviderWeight);
         json.Jsonize("retry_limit_per_second", retryLimitPerSecond,
                      retryLimitPerSecond);
+        json.Jsonize("retry_budget_percent", retryBudgetPercent,
+                     retryBudgetPercent);
+        json.Jsonize("retry_latency_percentile", retryLatencyPercentile,
+                     retryLatencyPercentile);
         json.Jsonize("latency_time_window_size", latencyTimeWindowSize,
                      latencyTimeWindowSize);
 
@@ -81,6 +87,8 @@ public:
                      beginServerDegradeErrorRatio, beginDegradeErrorRatio);
 
         json.Jsonize("min_weight", minWeight, minWeight);
+        json.Jsonize("power_of_two_choices", powerOfTwoChoices,
+                     powerOfTwoChoices);
 
         json.Jsonize("request_info_field", compatibleFieldInfo.requestInfoField,
                      compatibleFieldInfo.requestInfoField);
@@ -99,6 +107,7 @@ public:
     bool singleRetryEnabled() const {
         return latencyTimeWindowSize > DEFAULT_LATENCY_TIME_WINDOW_SIZE;
     }
+    bool retryBudgetEnabled() const { return MAX_PERCENT != retryBudgetPercent; }
     FlowControlConfig *clone();
     void validate();
     bool operator==(const FlowControlConfig &rhs) const;
@@ -121,6 +130,8 @@ public:
     uint32_t retryMinWaitTime; // ms
     int32_t retryMinProviderWeight;
     int32_t retryLimitPerSecond;
+    float retryBudgetPercent;     // percent of normal requests per second
+    float retryLatencyPercentile; // single retry trigger, 0 means avg latency
     int32_t latencyTimeWindowSize;
 
     float beginServerDegradeErrorRatio;
@@ -128,6 +139,9 @@ public:
     float fullDegradeErrorRatio;
 
     float minWeight;
+    // pick the better of two random providers by ewma latency and
+    // outstanding requests, ignored under consistent hash
+    bool powerOfTwoChoices;
 
     CompatibleFieldInfo compatibleFieldInfo;
 
@@ -121,6 +121,12 @@ void BizMapMetricReporter::reportReplyInfo(
             bizReporter->reportRetryQueryTriggerLatency(retryInfo.latency /
                                                         FACTOR_US_TO_MS);
         }
+        if (retryInfo.retryCallNum != 0) {
+            bizReporter->reportRetryCallQps(retryInfo.retryCallNum);
+        }
+        if (retryInfo.retrySuccNum != 0) {
+            bizReporter->reportRetryWinQps(retryInfo.retrySuccNum);
+        }
         if (replyBizInfo.probeCallNum != 0) {
             bizReporter->reportProbeCallQps(replyBizInfo.probeCallNum);
         }
@@ -96,6 +96,10 @@ BizMetricReporter::BizMetricReporter(const std::string &bizName,
                       _bizTags);
         DEFINE_METRIC(kMonitor, RetryQueryTriggerLatency,
                       "retryQueryTriggerLatency", GAUGE, NORMAL, _bizTags);
+        DEFINE_METRIC(kMonitor, RetryCallQps, "retryCallQps", QPS, NORMAL,
+                      _bizTags);
+        DEFINE_METRIC(kMonitor, RetryWinQps, "retryWinQps", QPS, NORMAL,
+                      _bizTags);
 
         DEFINE_METRIC(kMonitor, ProbeCallQps, "probeQps", QPS, NORMAL,
                       _bizTags);
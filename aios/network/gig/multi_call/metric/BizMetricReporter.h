@@ -63,6 +63,8 @@ private:
     DECLARE_METRIC(EarlyTerminatorTriggerLatency);
     DECLARE_METRIC(RetryQueryQps);
     DECLARE_METRIC(RetryQueryTriggerLatency);
+    DECLARE_METRIC(RetryCallQps);
+    DECLARE_METRIC(RetryWinQps);
 
     DECLARE_METRIC(ProbeCallQps);
     DECLARE_METRIC(CopyCallQps);
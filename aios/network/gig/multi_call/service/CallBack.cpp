@@ -26,9 +26,17 @@ AUTIL_LOG_SETUP(multi_call, CallBack);
 
 CallBack::CallBack(const SearchServiceResourcePtr &resource,
                    const CallerPtr &caller, bool isRetry)
-    : _resource(resource), _caller(caller), _isRetry(isRetry) {}
+    : _resource(resource), _caller(caller), _isRetry(isRetry),
+      _outstanding(false) {}
 
 CallBack::~CallBack() {
+    if (_outstanding && _resource) {
+        // dropped without run(), e.g. by an aborted stream
+        const auto &provider = _resource->getProvider(_isRetry);
+        if (provider) {
+            provider->decOutstanding();
+        }
+    }
     _caller.reset();
     _resource.reset();
 }
@@ -47,6 +55,10 @@ void CallBack::rpcBegin() {
     const auto &provider = _resource->getProvider(_isRetry);
     if (provider) {
         provider->updateRequestCounter(this);
+        if (!_outstanding && !isCopyRequest()) {
+            provider->incOutstanding();
+            _outstanding = true;
+        }
     }
 }
 
@@ -67,6 +79,13 @@ void CallBack::run(void *responseData, MultiCallErrorCode ec,
     }
 
     assert(_resource);
+    if (_outstanding) {
+        const auto &provider = _resource->getProvider(_isRetry);
+        if (provider) {
+            provider->decOutstanding();
+        }
+        _outstanding = false;
+    }
     auto response = _resource->getResponse(_isRetry);
     response->setCallBegTime(_resource->getCallBegTime());
     response->callEnd();
@@ -64,6 +64,7 @@ private:
     std::shared_ptr<SearchServiceResource> _resource;
     CallerPtr _caller;
     bool _isRetry;
+    bool _outstanding;
     opentelemetry::SpanPtr _span;
 
 private:
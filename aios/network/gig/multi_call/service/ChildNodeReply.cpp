@@ -60,6 +60,7 @@ void ChildNodeReply::endStreamQuery() {
         }
         auto response = searchResourcePtr->getReturnedResponse();
         if (response) {
+            updateRetryInfo(bizName, searchResourcePtr->hasRetried(), response);
             _replyInfoCollector->setBizLatency(
                 bizName, response->callUsedTime(), response->rpcUsedTime(),
                 response->netLatency());
@@ -94,9 +95,11 @@ size_t ChildNodeReply::fillResponses(std::vector<ResponsePtr> &responseVec, std:
             _replyInfoCollector->addRequestSize(bizName, request->size());
         }
         searchResourcePtr->freeRequest();
+        bool retried = searchResourcePtr->hasRetried();
         auto response = searchResourcePtr->stealReturnedResponse();
         if (response) {
             responseVec.push_back(response);
+            updateRetryInfo(bizName, retried, response);
             _replyInfoCollector->setBizLatency(
                 bizName, response->callUsedTime(), response->rpcUsedTime(),
                 response->netLatency());
@@ -130,6 +133,18 @@ size_t ChildNodeReply::fillResponses(std::vector<ResponsePtr> &responseVec, std:
     return _expectProviderCount - responseVec.size();
 }
 
+void ChildNodeReply::updateRetryInfo(const std::string &bizName, bool retried,
+                                     const ResponsePtr &response) {
+    if (!retried) {
+        return;
+    }
+    _replyInfoCollector->addRetryCallNum(bizName);
+    if (response->isRetried() && !response->isFailed()) {
+        // the backup request returned first
+        _replyInfoCollector->addRetrySuccessNum(bizName);
+    }
+}
+
 void ChildNodeReply::reportLinkMetric(
     const SearchServiceResourcePtr &searchResourcePtr,
     const ResponsePtr &responsePtr) {
@@ -248,6 +263,11 @@ bool ChildNodeReply::collectStatistic(const string &bizName, size_t providerCoun
         return false;
     }
     _callDelegationStatistic.collectStatistic(bizName, providerCount, flowControlConfig, disableRetry);
+    if (flowControlConfig->retryBudgetEnabled()) {
+        _retryLimitChecker->addRequest(clusterResponse.flowControlStrategy,
+                                       TimeUtility::currentTime() / FACTOR_S_TO_US,
+                                       providerCount);
+    }
     return true;
 }
 
@@ -279,10 +299,18 @@ void ChildNodeReply::getRetryBizs(int64_t currentTime,
         if (0 == stat.expectNum) {
             continue;
         }
+        const auto &strategy = clusterRsp.flowControlStrategy;
+        auto configPtr = _flowConfigSnapshot->getFlowControlConfig(strategy);
+        bool usePercentile = false;
         int64_t latency = numeric_limits<int64_t>::max();
         if (1 == stat.expectNum) {
             if (_callDelegationStatistic.IsSingleResultNeedRetry(stat)) {
-                latency = _latencyTimeSnapshot->getAvgLatency(bizName);
+                usePercentile = configPtr && configPtr->retryLatencyPercentile > 0.0f;
+                if (usePercentile) {
+                    latency = _latencyTimeSnapshot->getPercentileLatency(bizName);
+                } else {
+                    latency = _latencyTimeSnapshot->getAvgLatency(bizName);
+                }
             } else {
                 continue;
             }
@@ -293,14 +321,17 @@ void ChildNodeReply::getRetryBizs(int64_t currentTime,
                 continue;
             }
         }
-        const auto &strategy = clusterRsp.flowControlStrategy;
-        auto configPtr = _flowConfigSnapshot->getFlowControlConfig(strategy);
         int32_t retryMinProviderWeight = 0;
         if (configPtr) {
             retryMinProviderWeight = configPtr->retryMinProviderWeight;
         }
         if (clusterRsp.startRetryTime == numeric_limits<int64_t>::max()) {
-            if (configPtr) {
+            if (usePercentile) {
+                // hedge once the request is slower than the tracked percentile
+                clusterRsp.startRetryTime =
+                    _startTime +
+                    max(latency, (int64_t)configPtr->retryMinWaitTime * 1000);
+            } else if (configPtr) {
                 auto factor = configPtr->retryWaitTimeFactor;
                 clusterRsp.startRetryTime =
                     currentTime +
@@ -313,19 +344,43 @@ void ChildNodeReply::getRetryBizs(int64_t currentTime,
         int64_t timeout = min(_etTime, _startTime + _rpcTimeout);
         int64_t estimateRetryEndTime = latency + currentTime;
         if (estimateRetryEndTime <= timeout) {
+            int32_t retryCount = 1;
+            if (configPtr->retryBudgetEnabled()) {
+                retryCount = getRetryRequestCount(bizName);
+                if (0 == retryCount) {
+                    continue;
+                }
+            }
             if (_retryLimitChecker->canRetry(strategy,
                                              currentTime / FACTOR_S_TO_US,
-                                             configPtr->retryLimitPerSecond)) {
+                                             configPtr->retryLimitPerSecond,
+                                             configPtr->retryBudgetPercent,
+                                             retryCount)) {
                 retryBizInfos[bizName] = retryMinProviderWeight;
                 if (1 == stat.expectNum) {
                     _latencyTimeSnapshot->updateLatencyTimeWindow(
-                        bizName, configPtr->latencyTimeWindowSize);
+                        bizName, configPtr->latencyTimeWindowSize,
+                        configPtr->retryLatencyPercentile);
                 }
             }
         }
     }
 }
 
+// backup requests CallDelegationWorkItem::retry sends for this biz
+int32_t ChildNodeReply::getRetryRequestCount(const string &bizName) const {
+    int32_t count = 0;
+    for (const auto &resource : _searchResourceVec) {
+        if (resource->getBizName() != bizName || resource->hasRetried()) {
+            continue;
+        }
+        if (!resource->getResponse(false)->isReturned()) {
+            count++;
+        }
+    }
+    return count;
+}
+
 void ChildNodeReply::updateRetryBizs(
     const map<string, int32_t> &retryBizInfos) {
     for (const auto &info : retryBizInfos) {
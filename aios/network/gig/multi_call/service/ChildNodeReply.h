@@ -96,10 +96,13 @@ public:
 private:
     void doUpdateDetectInfo(int64_t currentTime, const std::string &bizName,
                             bool retryQueryEnabled);
+    int32_t getRetryRequestCount(const std::string &bizName) const;
     MetaEnv getMetaEnv(const SearchServiceResourcePtr &searchResourcePtr,
                        const ResponsePtr &responsePtr);
     void reportLinkMetric(const SearchServiceResourcePtr &searchResourcePtr,
                           const ResponsePtr &responsePtr);
+    void updateRetryInfo(const std::string &bizName, bool retried,
+                         const ResponsePtr &response);
 
 public:
     // for test
@@ -19,7 +19,8 @@ LatencyTimeSnapshot::LatencyTimeSnapshot() {
 LatencyTimeSnapshot::~LatencyTimeSnapshot() {}
 
 void LatencyTimeSnapshot::updateLatencyTimeWindow(const std::string &bizName,
-                                                  int64_t windowSize) {
+                                                  int64_t windowSize,
+                                                  float percentile) {
     if (0 == windowSize) {
         ScopedReadWriteLock lock(_mapLock, 'w');
         _latencyMap->erase(bizName);
@@ -38,6 +39,7 @@ void LatencyTimeSnapshot::updateLatencyTimeWindow(const std::string &bizName,
             latencyTimeWindow.reset(new LatencyTimeWindow(windowSize));
             (*_latencyMap)[bizName] = latencyTimeWindow;
         }
+        latencyTimeWindow->setPercentile(percentile);
     }
 }
 
@@ -61,6 +63,15 @@ int64_t LatencyTimeSnapshot::getAvgLatency(const std::string &bizName) {
     }
 }
 
+int64_t LatencyTimeSnapshot::getPercentileLatency(const std::string &bizName) {
+    auto latencyTimeWindow = getLatencyTimeWindow(bizName);
+    if (latencyTimeWindow) {
+        return latencyTimeWindow->getPercentileLatency();
+    } else {
+        return 0;
+    }
+}
+
 int64_t LatencyTimeSnapshot::pushLatency(const std::string &bizName,
                                          int64_t latency) {
     auto latencyTimeWindow = getLatencyTimeWindow(bizName);
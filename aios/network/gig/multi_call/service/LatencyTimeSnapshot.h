@@ -25,9 +25,10 @@ private:
 
 public:
     void updateLatencyTimeWindow(const std::string &bizName,
-                                 int64_t windowSize);
+                                 int64_t windowSize, float percentile = 0.0f);
     LatencyTimeWindowPtr getLatencyTimeWindow(const std::string &bizName);
     int64_t getAvgLatency(const std::string &bizName);
+    int64_t getPercentileLatency(const std::string &bizName);
     int64_t pushLatency(const std::string &bizName, int64_t latency);
 
 private:
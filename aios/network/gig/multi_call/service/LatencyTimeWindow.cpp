@@ -7,10 +7,12 @@
 
 #include "aios/network/gig/multi_call/service/LatencyTimeWindow.h"
 
+#include <algorithm>
+
 namespace multi_call {
 
 LatencyTimeWindow::LatencyTimeWindow(int64_t windowSize)
-    : _windowSize(windowSize) {}
+    : _windowSize(windowSize), _percentile(0.0f) {}
 
 LatencyTimeWindow::~LatencyTimeWindow() {}
 
@@ -25,7 +27,29 @@ int64_t LatencyTimeWindow::push(int64_t latency) {
     int64_t value = (latency << 10) + (avg * (_windowSize - 1));
     value /= _windowSize;
     _currentAvg.setValue(value);
+    if (_percentile > 0.0f) {
+        updatePercentile(latency << 10, value);
+    }
     return value >> 10;
 }
 
+/* 分位数的随机逼近估计
+ * 大于估计值时上调 step * p, 否则下调 step * (1 - p),
+ * 稳定时估计值即为 p 分位数, step 取 EMA / window 以适配延迟量级
+ */
+void LatencyTimeWindow::updatePercentile(int64_t latency, int64_t avg) {
+    int64_t current = _currentPercentile.getValue();
+    if (0 == current) {
+        _currentPercentile.setValue(latency);
+        return;
+    }
+    int64_t step = std::max(avg / _windowSize, (int64_t)1 << 10);
+    if (latency > current) {
+        current += (int64_t)(step * _percentile);
+    } else {
+        current -= (int64_t)(step * (1.0f - _percentile));
+    }
+    _currentPercentile.setValue(std::max(current, (int64_t)0));
+}
+
 } // namespace multi_call
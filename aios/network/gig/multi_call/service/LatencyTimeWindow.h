@@ -25,15 +25,24 @@ private:
 public:
     int64_t push(int64_t latency);
     inline int64_t getAvgLatency() { return _currentAvg.getValue() >> 10; }
+    inline int64_t getPercentileLatency() {
+        return _currentPercentile.getValue() >> 10;
+    }
     inline void setWindowSize(int64_t windowSize) {
         if (windowSize == 0)
             return;
         _windowSize = windowSize;
     }
+    inline void setPercentile(float percentile) { _percentile = percentile; }
+
+private:
+    void updatePercentile(int64_t latency, int64_t avg);
 
 private:
     int64_t _windowSize;
+    float _percentile;
     autil::AtomicCounter _currentAvg;
+    autil::AtomicCounter _currentPercentile;
 };
 
 MULTI_CALL_TYPEDEF_PTR(LatencyTimeWindow);
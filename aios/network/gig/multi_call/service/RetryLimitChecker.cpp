@@ -62,29 +62,84 @@ bool RetryCheckerItem::canRetry(int64_t currentTimeInSeconds,
     return true;
 }
 
-bool RetryLimitChecker::canRetry(const string &strategy, int64_t currentTimeInSeconds, int32_t retryCountLimit) {
-    RetryCheckerItem* item = nullptr;
+bool RetryCheckerItem::canRetry(int64_t currentTimeInSeconds,
+                                int32_t retryCountLimit,
+                                float retryBudgetPercent,
+                                int32_t retryCount) {
+    if (retryBudgetPercent >= MAX_PERCENT) {
+        return canRetry(currentTimeInSeconds, retryCountLimit);
+    }
+    ScopedWriteLock wlock(limitLock);
+    // budget is based on the last full second, the current second is used
+    // while warming up so that the first burst can still be hedged
+    int64_t requestCount = 0;
+    if (requestTimeStamp == currentTimeInSeconds) {
+        requestCount = max(lastRequestCountPerSecond, requestCountPerSecond);
+    } else if (requestTimeStamp + 1 == currentTimeInSeconds) {
+        requestCount = requestCountPerSecond;
+    }
+    int64_t budgetLimit = (int64_t)(requestCount * retryBudgetPercent);
+    if (retryCountLimit >= 0) {
+        budgetLimit = min(budgetLimit, (int64_t)retryCountLimit);
+    }
+    if (retryTimeStamp != currentTimeInSeconds) {
+        retryTimeStamp = currentTimeInSeconds;
+        retryCountPerSecond = 0;
+    }
+    // requests and retries are both counted per partition request, so a
+    // biz retry is charged for every backup request it sends
+    if (retryCountPerSecond + retryCount > budgetLimit) {
+        return false;
+    }
+    retryCountPerSecond += retryCount;
+    return true;
+}
+
+void RetryCheckerItem::addRequest(int64_t currentTimeInSeconds, int64_t count) {
+    ScopedWriteLock wlock(limitLock);
+    if (requestTimeStamp == currentTimeInSeconds) {
+        requestCountPerSecond += count;
+        return;
+    }
+    if (requestTimeStamp + 1 == currentTimeInSeconds) {
+        lastRequestCountPerSecond = requestCountPerSecond;
+    } else {
+        lastRequestCountPerSecond = 0;
+    }
+    requestTimeStamp = currentTimeInSeconds;
+    requestCountPerSecond = count;
+}
+
+RetryCheckerItem *RetryLimitChecker::getCheckerItem(const string &strategy) {
     {
         ScopedReadLock rlock(_checkerLock);
         auto iter = _StrategyRetryChecker.find(strategy);
         if (_StrategyRetryChecker.end() != iter) {
-            item = iter->second.get();
+            return iter->second.get();
         }
     }
-    if (item) {
-        return item->canRetry(currentTimeInSeconds, retryCountLimit);
-    } else {
-        ScopedWriteLock wlock(_checkerLock);
-        auto iter = _StrategyRetryChecker.find(strategy);
-        if (_StrategyRetryChecker.end() != iter) {
-            return iter->second->canRetry(currentTimeInSeconds, retryCountLimit);
-        } else {
-            auto checkerItem = make_unique<RetryCheckerItem>();
-            bool ret = checkerItem->canRetry(currentTimeInSeconds, retryCountLimit);
-            _StrategyRetryChecker[strategy] = std::move(checkerItem);
-            return ret;
-        }
+    ScopedWriteLock wlock(_checkerLock);
+    auto &item = _StrategyRetryChecker[strategy];
+    if (!item) {
+        item = make_unique<RetryCheckerItem>();
     }
+    return item.get();
+}
+
+bool RetryLimitChecker::canRetry(const string &strategy, int64_t currentTimeInSeconds, int32_t retryCountLimit) {
+    return getCheckerItem(strategy)->canRetry(currentTimeInSeconds, retryCountLimit);
+}
+
+bool RetryLimitChecker::canRetry(const string &strategy, int64_t currentTimeInSeconds,
+                                 int32_t retryCountLimit, float retryBudgetPercent,
+                                 int32_t retryCount) {
+    return getCheckerItem(strategy)->canRetry(currentTimeInSeconds, retryCountLimit,
+                                              retryBudgetPercent, retryCount);
+}
+
+void RetryLimitChecker::addRequest(const string &strategy, int64_t currentTimeInSeconds,
+                                   int64_t count) {
+    getCheckerItem(strategy)->addRequest(currentTimeInSeconds, count);
 }
 
 } // namespace multi_call
@@ -18,6 +18,7 @@
 
 #include <unordered_map>
 
+#include "aios/network/gig/multi_call/common/ControllerParam.h"
 #include "aios/network/gig/multi_call/common/common.h"
 #include "autil/Lock.h"
 
@@ -26,8 +27,14 @@ namespace multi_call {
 struct RetryCheckerItem {
     int32_t retryCountPerSecond = 0;
     int64_t retryTimeStamp = 0;
+    int64_t requestCountPerSecond = 0;
+    int64_t lastRequestCountPerSecond = 0;
+    int64_t requestTimeStamp = 0;
     autil::ReadWriteLock limitLock;
     bool canRetry(int64_t currentTimeInSeconds, int32_t retryCountLimit);
+    bool canRetry(int64_t currentTimeInSeconds, int32_t retryCountLimit,
+                  float retryBudgetPercent, int32_t retryCount);
+    void addRequest(int64_t currentTimeInSeconds, int64_t count);
 
 private:
     AUTIL_LOG_DECLARE();
@@ -43,6 +50,12 @@ private:
 
 public:
     bool canRetry(const std::string &strategy, int64_t currentTimeInSeconds, int32_t retryCountLimit);
+    bool canRetry(const std::string &strategy, int64_t currentTimeInSeconds, int32_t retryCountLimit,
+                  float retryBudgetPercent, int32_t retryCount);
+    void addRequest(const std::string &strategy, int64_t currentTimeInSeconds, int64_t count);
+
+private:
+    RetryCheckerItem *getCheckerItem(const std::string &strategy);
 
 private:
     std::unordered_map<std::string, std::unique_ptr<RetryCheckerItem>> _StrategyRetryChecker;
@@ -38,6 +38,7 @@ SearchServiceProvider::SearchServiceProvider(const ConnectionManagerPtr &connect
     , _weightBonus(WEIGHT_DEC_LIMIT)
     , _useDefaultProbePercent(false)
     , _loadBalanceWeightFactor(MAX_PERCENT)
+    , _ewmaLatencyMs(0.0f)
     , _connectionManager(connectionManager)
     , _spec(topoNode.spec)
     , _nodeId(topoNode.nodeId)
@@ -51,6 +52,7 @@ SearchServiceProvider::SearchServiceProvider(const ConnectionManagerPtr &connect
             _nodeId.size());
 
     atomic_set(&_previousServerVersion, 0);
+    atomic_set(&_outstandingCount, 0);
     _nodeMeta = topoNode.meta;
     _targetMetaEnv = topoNode.meta.metaEnv;
     _hbInfo = topoNode.hbInfo;
@@ -202,6 +204,7 @@ void SearchServiceProvider::updateWeight(ControllerFeedBack &feedBack) {
     diff = min(diff, _controllerChain.errorController.update(feedBack));
     diff = min(diff, _controllerChain.warmUpController.update(feedBack));
     updateLoadBalance(feedBack, false);
+    updateEwmaLatency(feedBack.stat);
     auto hasError = feedBack.stat.isFailed();
     auto newTargetWeight = min(_nodeMeta.targetWeight, feedBack.stat.targetWeight);
     if (hasError) {
@@ -221,6 +224,27 @@ void SearchServiceProvider::updateWeight(ControllerFeedBack &feedBack) {
     doUpdateWeight(diff, feedBack.minWeight);
 }
 
+void SearchServiceProvider::updateEwmaLatency(const QueryResultStatistic &stat) {
+    float latencyMs = stat.getLatency() / FACTOR_US_TO_MS;
+    float current = _ewmaLatencyMs.load(std::memory_order_relaxed);
+    float next;
+    do {
+        if (current <= 0.0f) {
+            next = latencyMs;
+        } else {
+            next = current + EWMA_LATENCY_ALPHA * (latencyMs - current);
+        }
+    } while (!_ewmaLatencyMs.compare_exchange_weak(current, next, std::memory_order_relaxed));
+}
+
+float SearchServiceProvider::getSelectScore() const {
+    // C3 style ranking: penalize queue size cubically so that a stalled
+    // replica sheds load before its averaged latency catches up
+    float queueSize = 1.0f + std::max(getOutstanding(), (int64_t)0);
+    float latency = std::max(getEwmaLatency(), EWMA_LATENCY_MIN_MS);
+    return latency * queueSize * queueSize * queueSize;
+}
+
 void SearchServiceProvider::updateLoadBalance(ControllerFeedBack &feedBack,
                                               bool updateWeight) {
     if (unlikely(isCopy())) {
@@ -27,6 +27,7 @@
 #include "aios/network/gig/multi_call/util/RandomGenerator.h"
 #include "aios/network/gig/multi_call/util/DiffCounter.h"
 #include "autil/Lock.h"
+#include <atomic>
 
 namespace multi_call {
 
@@ -136,6 +137,15 @@ public:
     void setHostStats(const std::shared_ptr<HostHeartbeatStats> &hostStats);
     void incStreamQueryCount();
     void incStreamResponseCount();
+    void incOutstanding() { atomic_inc(&_outstandingCount); }
+    void decOutstanding() { atomic_dec(&_outstandingCount); }
+    int64_t getOutstanding() const {
+        return atomic_read(&_outstandingCount);
+    }
+    float getEwmaLatency() const {
+        return _ewmaLatencyMs.load(std::memory_order_relaxed);
+    }
+    float getSelectScore() const;
 public:
     static bool isBetterThan(const ControllerChain *thisChain,
                              const ControllerChain *bestChain,
@@ -144,6 +154,7 @@ public:
 
 private:
     float approachTargetWeight(float targetWeight);
+    void updateEwmaLatency(const QueryResultStatistic &stat);
     void updateWeightFactor(int64_t version, float newFactor);
     void updateCachedWeight(float minWeight = MIN_WEIGHT_FLOAT);
     ConnectionPtr getConnection(ProtocolType type);
@@ -201,6 +212,8 @@ private:
     volatile bool _useDefaultProbePercent;
     volatile float _loadBalanceWeightFactor;
     volatile atomic64_t _previousServerVersion;
+    atomic64_t _outstandingCount;
+    std::atomic<float> _ewmaLatencyMs;
 
     ConnectionPtr _connection[MC_PROTOCOL_UNKNOWN + 1];
     mutable autil::ReadWriteLock _connectionLock;
@@ -128,6 +128,8 @@ SearchServiceProviderPtr SearchServiceReplica::getProviderByHashKey(
     SearchServiceProviderPtr provider;
     if (HashPolicy::CONSISTENT_HASH == _hashPolicy) {
         provider = getProviderFromConsistHash(providerVec, key, param, probeProvider, type);
+    } else if (param.flowControlConfig && param.flowControlConfig->powerOfTwoChoices) {
+        provider = getProviderFromPowerOfTwo(providerVec, param, probeProvider, type);
     } else {
         provider = getProviderFromRandomHash(providerVec, key, param, probeProvider, type);
     }
@@ -269,6 +271,36 @@ SearchServiceProviderPtr SearchServiceReplica::getProviderFromRandomHash(
     }
 }
 
+SearchServiceProviderPtr SearchServiceReplica::getProviderFromPowerOfTwo(
+    const SearchServiceProviderVector &serviceVector, const FlowControlParam &param,
+    SearchServiceProviderPtr &probeProvider, RequestType &type)
+{
+    auto probeRand = _randomGenerator.get();
+    const auto &probeCandidate = serviceVector[probeRand % serviceVector.size()];
+    if (probeCandidate && needProbe(probeCandidate, param.flowControlConfig, type)) {
+        probeProvider = probeCandidate;
+    }
+    // candidates must pass the weight controllers, so degraded or failing
+    // providers are still excluded as in the weighted policies
+    vector<RandomHashNode> weights;
+    if (0 == getRandomHashWeights(serviceVector, weights)) {
+        return SearchServiceProviderPtr();
+    }
+    auto count = weights.size();
+    auto firstPos = _randomGenerator.get() % count;
+    const auto &first = serviceVector[weights[firstPos].index];
+    if (1 == count) {
+        return first;
+    }
+    auto secondPos = (firstPos + 1 + _randomGenerator.get() % (count - 1)) % count;
+    const auto &second = serviceVector[weights[secondPos].index];
+    if (second->getSelectScore() < first->getSelectScore()) {
+        return second;
+    } else {
+        return first;
+    }
+}
+
 uint32_t
 SearchServiceReplica::getRandomHashWeights(const SearchServiceProviderVector &serviceVector,
                                            vector<RandomHashNode> &weights) const
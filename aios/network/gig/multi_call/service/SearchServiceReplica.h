@@ -97,6 +97,10 @@ private:
     getProviderFromRandomHash(const SearchServiceProviderVector &serviceVector, SourceIdTy key,
                               const FlowControlParam &param,
                               SearchServiceProviderPtr &probeProvider, RequestType &type);
+    SearchServiceProviderPtr
+    getProviderFromPowerOfTwo(const SearchServiceProviderVector &serviceVector,
+                              const FlowControlParam &param,
+                              SearchServiceProviderPtr &probeProvider, RequestType &type);
     uint32_t getRandomHashWeights(const SearchServiceProviderVector &serviceVector,
                                   std::vector<RandomHashNode> &weights) const;
     bool getDegradeCoverPercent(const FlowControlConfigPtr &flowControlConfig,
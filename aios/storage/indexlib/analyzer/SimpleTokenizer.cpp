@@ -15,12 +15,53 @@
  */
 #include "indexlib/analyzer/SimpleTokenizer.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "autil/StringUtil.h"
 #include "indexlib/analyzer/AnalyzerDefine.h"
 
 namespace indexlibv2 { namespace analyzer {
 AUTIL_LOG_SETUP(indexlib.analyzer, SimpleTokenizer);
 
+namespace {
+// same positions as sundaySearch with a single char key, compares a block of chars at a time
+void FindCharPositions(const char* text, size_t textLen, char c, std::vector<size_t>& posVec)
+{
+    posVec.clear();
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i target = _mm256_set1_epi8(c);
+    for (; i + 32 <= textLen; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(text + i));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, target));
+        while (mask) {
+            posVec.push_back(i + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i target = _mm_set1_epi8(c);
+    for (; i + 16 <= textLen; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(text + i));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, target));
+        while (mask) {
+            posVec.push_back(i + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < textLen; ++i) {
+        if (text[i] == c) {
+            posVec.push_back(i);
+        }
+    }
+}
+} // namespace
+
 SimpleTokenizer::SimpleTokenizer(const std::string& delimiter)
 {
     _delimiter = delimiter;
@@ -42,7 +83,11 @@ void SimpleTokenizer::tokenize(const char* text, size_t textLen)
     _text = text;
     _textLen = textLen;
 
-    autil::StringUtil::sundaySearch(_text, _textLen, _delimiter.c_str(), _delimiter.size(), _posVec);
+    if (_delimiter.size() == 1) {
+        FindCharPositions(_text, _textLen, _delimiter[0], _posVec);
+    } else {
+        autil::StringUtil::sundaySearch(_text, _textLen, _delimiter.c_str(), _delimiter.size(), _posVec);
+    }
     _curPos = 0;
     _position = 0;
     _begin = _text;
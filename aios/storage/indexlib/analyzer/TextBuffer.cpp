@@ -15,6 +15,8 @@
  */
 #include "indexlib/analyzer/TextBuffer.h"
 
+#include <string.h>
+
 #include "autil/codec/EncodeConverter.h"
 
 using namespace std;
@@ -31,6 +33,7 @@ TextBuffer::TextBuffer()
     _normalizedUTF8Text = NULL;
     _orignalUTF16TextLen = 0;
     _curTokenPos = 0;
+    _isASCII = false;
 }
 
 TextBuffer::~TextBuffer() { delete[] _buf; }
@@ -68,6 +71,15 @@ void TextBuffer::reset(int32_t strLen)
 void TextBuffer::normalize(const autil::codec::NormalizerPtr& normalizerPtr, const char* str, size_t& len)
 {
     resize(len);
+    if (normalizerPtr->normalizeASCII(str, len, _normalizedUTF8Text)) {
+        memcpy(_orignalUTF16Text, str, len);
+        _orignalUTF16TextLen = len;
+        _isASCII = true;
+        _normalizedUTF8Text[len] = '\0';
+        AUTIL_LOG(DEBUG, "normalized ascii string: [%s]", _normalizedUTF8Text);
+        return;
+    }
+    _isASCII = false;
     _orignalUTF16TextLen = autil::codec::EncodeConverter::utf8ToUtf16(str, len, _orignalUTF16Text);
     normalizerPtr->normalizeUTF16(_orignalUTF16Text, _orignalUTF16TextLen, _normalizedUTF16Text);
     len = autil::codec::EncodeConverter::utf16ToUtf8(_normalizedUTF16Text, _orignalUTF16TextLen, _normalizedUTF8Text);
@@ -82,6 +94,9 @@ bool TextBuffer::nextTokenOrignalText(const std::string& tokenNormalizedUTF8Text
     if (utf16Len < 0 || _curTokenPos + utf16Len > _orignalUTF16TextLen) {
         AUTIL_LOG(DEBUG, "failed to calc the orignal text len, use the normalized text");
         return false;
+    } else if (_isASCII) {
+        tokenOrignalText.assign((const char*)_orignalUTF16Text + _curTokenPos, utf16Len);
+        _curTokenPos += utf16Len;
     } else {
         // reuse the normalized utf16 text buffer
         char* buf = (char*)_normalizedUTF16Text;
@@ -52,6 +52,8 @@ private:
     int32_t _size;
     int32_t _orignalUTF16TextLen;
     int32_t _curTokenPos;
+    // pure ascii text skips utf16 convert, _orignalUTF16Text holds the orignal bytes then
+    bool _isASCII;
 
 private:
     AUTIL_LOG_DECLARE();
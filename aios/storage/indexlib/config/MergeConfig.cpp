@@ -31,6 +31,7 @@ struct MergeConfig::Impl {
     std::string mergeStrategyStr = "optimize"; // OPTIMIZE_MERGE_STRATEGY_STR
     int64_t maxMergeMemoryUseMB = 40 * 1024;   // 40GB
     uint32_t mergeThreadCount = 20;
+    uint32_t mergeTermRangeCount = 1; // inverted index terms merged by ranges in parallel
     MergeStrategyParameter mergeStrategyParameter;
     bool enablePatchFileArchive = false;
     bool enablePatchFileMeta = false;
@@ -46,6 +47,7 @@ void MergeConfig::Jsonize(autil::legacy::Jsonizable::JsonWrapper& json)
     json.Jsonize("merge_strategy_params", _impl->mergeStrategyParameter, _impl->mergeStrategyParameter);
     json.Jsonize("max_merge_memory_use", _impl->maxMergeMemoryUseMB, _impl->maxMergeMemoryUseMB);
     json.Jsonize("merge_thread_count", _impl->mergeThreadCount, _impl->mergeThreadCount);
+    json.Jsonize("merge_term_range_count", _impl->mergeTermRangeCount, _impl->mergeTermRangeCount);
     json.Jsonize("enable_patch_file_archive", _impl->enablePatchFileArchive, _impl->enablePatchFileArchive);
     json.Jsonize("enable_patch_file_meta", _impl->enablePatchFileMeta, _impl->enablePatchFileMeta);
     json.Jsonize("enable_package_file", _impl->enablePackageFile, _impl->enablePackageFile);
@@ -76,6 +78,11 @@ void MergeConfig::Check() const
                            "merge_thread_count should be greater than 0 and no more than " +
                                std::to_string(MAX_MERGE_THREAD_COUNT));
     }
+    if (_impl->mergeTermRangeCount == 0 || _impl->mergeTermRangeCount > MAX_MERGE_THREAD_COUNT) {
+        AUTIL_LEGACY_THROW(autil::legacy::ParameterInvalidException,
+                           "merge_term_range_count should be greater than 0 and no more than " +
+                               std::to_string(MAX_MERGE_THREAD_COUNT));
+    }
 }
 
 MergeConfig::MergeConfig() : _impl(std::make_unique<MergeConfig::Impl>()) {}
@@ -92,6 +99,7 @@ MergeConfig::~MergeConfig() {}
 const std::string& MergeConfig::GetMergeStrategyStr() const { return _impl->mergeStrategyStr; }
 int64_t MergeConfig::GetMaxMergeMemoryUse() const { return _impl->maxMergeMemoryUseMB * 1024 * 1024; }
 uint32_t MergeConfig::GetMergeThreadCount() const { return _impl->mergeThreadCount; }
+uint32_t MergeConfig::GetMergeTermRangeCount() const { return _impl->mergeTermRangeCount; }
 const MergeStrategyParameter& MergeConfig::GetMergeStrategyParameter() const { return _impl->mergeStrategyParameter; }
 bool MergeConfig::EnablePatchFileMeta() const { return _impl->enablePatchFileMeta; }
 bool MergeConfig::EnablePatchFileArchive() const { return _impl->enablePatchFileArchive; }
@@ -132,6 +140,7 @@ void MergeConfig::TEST_SetMaxMergeMemoryUse(int64_t maxMergeMemoryUse)
     _impl->maxMergeMemoryUseMB = maxMergeMemoryUse / 1024 / 1024;
 }
 void MergeConfig::TEST_SetMergeThreadCount(uint32_t count) { _impl->mergeThreadCount = count; }
+void MergeConfig::TEST_SetMergeTermRangeCount(uint32_t count) { _impl->mergeTermRangeCount = count; }
 void MergeConfig::TEST_SetEnablePatchFileMeta(bool enabled) { _impl->enablePatchFileMeta = enabled; }
 void MergeConfig::TEST_SetEnablePatchFileArchive(bool enabled) { _impl->enablePatchFileArchive = enabled; }
 void MergeConfig::TEST_SetEnablePackageFile(bool enabled) { _impl->enablePackageFile = enabled; }
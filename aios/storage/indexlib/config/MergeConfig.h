@@ -40,6 +40,7 @@ public:
     const std::string& GetMergeStrategyStr() const;
     int64_t GetMaxMergeMemoryUse() const;
     uint32_t GetMergeThreadCount() const;
+    uint32_t GetMergeTermRangeCount() const;
     const MergeStrategyParameter& GetMergeStrategyParameter() const;
     bool EnablePatchFileMeta() const;
     bool EnablePatchFileArchive() const;
@@ -54,6 +55,7 @@ public:
     void TEST_SetMergeStrategyParameter(const MergeStrategyParameter& param);
     void TEST_SetMaxMergeMemoryUse(int64_t maxMemUseForMerge);
     void TEST_SetMergeThreadCount(uint32_t count);
+    void TEST_SetMergeTermRangeCount(uint32_t count);
     void TEST_SetEnablePatchFileMeta(bool enabled);
     void TEST_SetEnablePatchFileArchive(bool enabled);
     void TEST_SetEnablePackageFile(bool enable);
@@ -97,8 +97,9 @@ public:
 
     void serialize(autil::DataBuffer& dataBuffer) const;
     inline void serializeVersion8(autil::DataBuffer& dataBuffer) const;
+    // fields point into dataBuffer when copyData is false
     void deserialize(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool,
-                     uint32_t docVersion = DOCUMENT_BINARY_VERSION);
+                     uint32_t docVersion = DOCUMENT_BINARY_VERSION, bool copyData = true);
     inline void deserializeVersion8(autil::DataBuffer& dataBuffer);
 
     bool operator==(const AttributeDocument& right) const;
@@ -140,12 +141,16 @@ inline void __ALWAYS_INLINE AttributeDocument::serializeVersion8(autil::DataBuff
 }
 
 inline void AttributeDocument::deserialize(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool,
-                                           uint32_t docVersion)
+                                           uint32_t docVersion, bool copyData)
 {
     // version 7 and belows
     ResetPackFields();
-    _normalAttrDoc.deserialize(dataBuffer, pool);
-    dataBuffer.read(_packFields, pool);
+    _normalAttrDoc.deserialize(dataBuffer, pool, copyData);
+    if (copyData) {
+        dataBuffer.read(_packFields, pool);
+    } else {
+        dataBuffer.read(_packFields);
+    }
 }
 
 inline void __ALWAYS_INLINE AttributeDocument::deserializeVersion8(autil::DataBuffer& dataBuffer)
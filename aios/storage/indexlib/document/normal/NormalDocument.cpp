@@ -166,6 +166,18 @@ void NormalDocument::deserialize(autil::DataBuffer& dataBuffer)
     DoDeserialize(dataBuffer, _serializedVersion);
 }
 
+void NormalDocument::deserializeNoCopy(autil::DataBuffer& dataBuffer)
+{
+    _copyOnDeserialize = false;
+    try {
+        deserialize(dataBuffer);
+    } catch (...) {
+        _copyOnDeserialize = true;
+        throw;
+    }
+    _copyOnDeserialize = true;
+}
+
 bool NormalDocument::operator==(const NormalDocument& doc) const
 {
     if (this == &doc) {
@@ -568,8 +580,8 @@ void NormalDocument::deserializeVersion6(DataBuffer& dataBuffer)
     assert(_pool);
     uint32_t documentVersion = 6;
     _indexDocument.reset(deserializeObject<IndexDocument>(dataBuffer, _pool.get(), documentVersion));
-    _attributeDocument.reset(deserializeObject<AttributeDocument>(dataBuffer, _pool.get(), documentVersion));
-    _summaryDocument.reset(deserializeObject<SerializedSummaryDocument>(dataBuffer, documentVersion));
+    _attributeDocument.reset(deserializeValueObject<AttributeDocument>(dataBuffer, _pool.get(), documentVersion));
+    _summaryDocument.reset(deserializeValueObject<SerializedSummaryDocument>(dataBuffer, documentVersion));
     // not support sub document yet, make sure the serialized data is compatile
     DocumentVector subDocuments;
     dataBuffer.read(subDocuments);
@@ -610,8 +622,8 @@ void NormalDocument::deserializeVersion7(DataBuffer& dataBuffer)
     assert(_pool);
     uint32_t documentVersion = 7;
     _indexDocument.reset(deserializeObject<IndexDocument>(dataBuffer, _pool.get(), documentVersion));
-    _attributeDocument.reset(deserializeObject<AttributeDocument>(dataBuffer, _pool.get(), documentVersion));
-    _summaryDocument.reset(deserializeObject<SerializedSummaryDocument>(dataBuffer, documentVersion));
+    _attributeDocument.reset(deserializeValueObject<AttributeDocument>(dataBuffer, _pool.get(), documentVersion));
+    _summaryDocument.reset(deserializeValueObject<SerializedSummaryDocument>(dataBuffer, documentVersion));
     // not support sub document yet, make sure the serialized data is compatile
     DocumentVector subDocuments;
     dataBuffer.read(subDocuments);
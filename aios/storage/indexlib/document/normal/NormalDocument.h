@@ -91,6 +91,9 @@ public:
 
     void serialize(autil::DataBuffer& dataBuffer) const override;
     void deserialize(autil::DataBuffer& dataBuffer) override;
+    // attribute, summary and source values point into dataBuffer instead of being copied,
+    // the data of dataBuffer must live as long as this document, e.g. be allocated from GetPool()
+    void deserializeNoCopy(autil::DataBuffer& dataBuffer);
 
     void ModifyDocOperateType(DocOperateType op) { _opType = op; }
     autil::StringView GetTraceId() const override;
@@ -230,6 +233,33 @@ private:
         return ptr.release();
     }
 
+    // for objects whose values can point into dataBuffer, see deserializeNoCopy
+    template <typename T>
+    inline T* deserializeValueObject(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool, uint32_t docVersion)
+    {
+        bool hasObj;
+        dataBuffer.read(hasObj);
+        if (!hasObj) {
+            return NULL;
+        }
+        std::unique_ptr<T> ptr(new T(pool));
+        ptr->deserialize(dataBuffer, pool, docVersion, _copyOnDeserialize);
+        return ptr.release();
+    }
+
+    template <typename T>
+    inline T* deserializeValueObject(autil::DataBuffer& dataBuffer, uint32_t docVersion)
+    {
+        bool hasObj;
+        dataBuffer.read(hasObj);
+        if (!hasObj) {
+            return NULL;
+        }
+        std::unique_ptr<T> ptr(new T());
+        ptr->deserialize(dataBuffer, docVersion, _copyOnDeserialize);
+        return ptr.release();
+    }
+
     void deserializeVersion3(autil::DataBuffer& dataBuffer);
     void deserializeVersion4(autil::DataBuffer& dataBuffer);
     void deserializeVersion5(autil::DataBuffer& dataBuffer);
@@ -243,7 +273,7 @@ private:
     inline void deserializeVersion9(autil::DataBuffer& dataBuffer)
     {
         _sourceDocument.reset(
-            deserializeObject<indexlib::document::SerializedSourceDocument>(dataBuffer, _pool.get(), 9));
+            deserializeValueObject<indexlib::document::SerializedSourceDocument>(dataBuffer, _pool.get(), 9));
     }
     inline void deserializeVersion10(autil::DataBuffer& dataBuffer)
     {
@@ -287,6 +317,7 @@ private:
     DocOperateType _opType = UNKNOWN_OP;
     DocOperateType _originalOpType = UNKNOWN_OP;
     mutable uint32_t _serializedVersion = INVALID_DOC_VERSION;
+    bool _copyOnDeserialize = true;
     uint32_t _ttl = 0;
     DocInfo _docInfo;
     TagInfoMap _tagInfo; // legacy mSource
@@ -37,6 +37,7 @@ NormalDocumentParser::NormalDocumentParser(const std::shared_ptr<analyzer::IAnal
     , _needParseRawDoc(needParseRawDoc)
 {
     _enableModifyFieldStat = autil::EnvUtil::getEnv("INDEXLIB_ENABLE_STAT_MODIFY_FIELDS", _enableModifyFieldStat);
+    _zeroCopyDeserialize = autil::EnvUtil::getEnv("INDEXLIB_ZERO_COPY_DESERIALIZE_DOC", _zeroCopyDeserialize);
 }
 
 NormalDocumentParser::~NormalDocumentParser() {}
@@ -228,8 +229,18 @@ NormalDocumentParser::Parse(const autil::StringView& serializedData) const
         } else {
             RETURN2_IF_STATUS_ERROR(Status::Corruption(), nullptr, "document deserialize failed");
         }
-        autil::DataBuffer dataBuffer(const_cast<char*>(serializedData.data()), serializedData.length());
-        dataBuffer.read(document);
+        if (_zeroCopyDeserialize) {
+            // copy the message into the document pool once, values of the document point into it
+            document = std::make_shared<NormalDocument>();
+            char* data = (char*)document->GetPool()->allocate(serializedData.length());
+            memcpy(data, serializedData.data(), serializedData.length());
+            autil::DataBuffer dataBuffer(data, serializedData.length());
+            dataBuffer.read(hasObj);
+            document->deserializeNoCopy(dataBuffer);
+        } else {
+            autil::DataBuffer dataBuffer(const_cast<char*>(serializedData.data()), serializedData.length());
+            dataBuffer.read(document);
+        }
     } catch (const std::exception& e) {
         RETURN2_IF_STATUS_ERROR(Status::Corruption(), nullptr, "normal document deserialize failed, exception[%s]",
                                 e.what());
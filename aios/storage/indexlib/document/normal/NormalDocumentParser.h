@@ -85,6 +85,7 @@ private:
     bool _supportNull = false;
     bool _enableModifyFieldStat = false;
     bool _needParseRawDoc = false;
+    bool _zeroCopyDeserialize = false;
 
 public:
     inline static const std::string ATTRIBUTE_CONVERT_ERROR_COUNTER_NAME = "bs.processor.attributeConvertError";
@@ -92,8 +92,11 @@ void Section::deserialize(autil::DataBuffer& dataBuffer)
     dataBuffer.read(_tokenUsed);
     IE_POOL_COMPATIBLE_DELETE_VECTOR(_pool, _tokens, _tokenCapacity);
     _tokens = IE_POOL_COMPATIBLE_NEW_VECTOR(_pool, Token, _tokenUsed);
-    for (size_t i = 0; i < _tokenUsed; i++) {
-        dataBuffer.read(_tokens[i]);
+    // packed token has the same layout as its serialized fields, read all tokens in one copy
+    static_assert(sizeof(Token) == sizeof(uint64_t) + sizeof(pos_t) + sizeof(pospayload_t),
+                  "token layout differs from its serialized format");
+    if (_tokenUsed > 0) {
+        dataBuffer.readBytes(_tokens, _tokenUsed * sizeof(Token));
     }
     dataBuffer.read(_sectionId);
     dataBuffer.read(_length);
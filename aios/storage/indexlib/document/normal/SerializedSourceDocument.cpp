@@ -57,7 +57,7 @@ void SerializedSourceDocument::serialize(autil::DataBuffer& dataBuffer) const
 }
 
 void SerializedSourceDocument::deserialize(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool,
-                                           uint32_t docVersion)
+                                           uint32_t docVersion, bool copyData)
 {
     assert(docVersion >= 9);
     assert(pool);
@@ -65,9 +65,7 @@ void SerializedSourceDocument::deserialize(autil::DataBuffer& dataBuffer, autil:
     uint32_t metaLen = 0;
     dataBuffer.read(metaLen);
     if (metaLen > 0) {
-        char* metaData = (char*)pool->allocate(metaLen);
-        dataBuffer.readBytes(metaData, metaLen);
-        _meta = autil::StringView(metaData, metaLen);
+        _meta = autil::StringView(ReadBytes(dataBuffer, pool, metaLen, copyData), metaLen);
     } else {
         _meta = autil::StringView::empty_instance();
     }
@@ -81,36 +79,39 @@ void SerializedSourceDocument::deserialize(autil::DataBuffer& dataBuffer, autil:
             _data[i] = autil::StringView::empty_instance();
             continue;
         }
-        char* data = (char*)pool->allocate(dataLen);
-        dataBuffer.readBytes(data, dataLen);
-        _data[i] = autil::StringView(data, dataLen);
+        _data[i] = autil::StringView(ReadBytes(dataBuffer, pool, dataLen, copyData), dataLen);
     }
 
     uint32_t accessaryMetaLen = 0;
     dataBuffer.read(accessaryMetaLen);
     if (accessaryMetaLen > 0) {
-        char* accessaryMeta = (char*)pool->allocate(accessaryMetaLen);
-        dataBuffer.readBytes(accessaryMeta, accessaryMetaLen);
-        _accessaryMeta = {accessaryMeta, accessaryMetaLen};
+        _accessaryMeta = {ReadBytes(dataBuffer, pool, accessaryMetaLen, copyData), accessaryMetaLen};
     }
 
     uint32_t accessaryDataLen = 0;
     dataBuffer.read(accessaryDataLen);
     if (accessaryDataLen > 0) {
-        char* accessaryData = (char*)pool->allocate(accessaryDataLen);
-        dataBuffer.readBytes(accessaryData, accessaryDataLen);
-        _accessaryData = {accessaryData, accessaryDataLen};
+        _accessaryData = {ReadBytes(dataBuffer, pool, accessaryDataLen, copyData), accessaryDataLen};
     }
 
     uint32_t nonExistFieldInfoLen = 0;
     dataBuffer.read(nonExistFieldInfoLen);
     if (nonExistFieldInfoLen > 0) {
-        char* nonExistFieldInfoData = (char*)pool->allocate(nonExistFieldInfoLen);
-        dataBuffer.readBytes(nonExistFieldInfoData, nonExistFieldInfoLen);
-        _nonExistFieldInfo = {nonExistFieldInfoData, nonExistFieldInfoLen};
+        _nonExistFieldInfo = {ReadBytes(dataBuffer, pool, nonExistFieldInfoLen, copyData), nonExistFieldInfoLen};
     }
 }
 
+const char* SerializedSourceDocument::ReadBytes(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool,
+                                                uint32_t len, bool copyData)
+{
+    if (!copyData) {
+        return (const char*)dataBuffer.readNoCopy(len);
+    }
+    char* data = (char*)pool->allocate(len);
+    dataBuffer.readBytes(data, len);
+    return data;
+}
+
 const StringView SerializedSourceDocument::GetGroupValue(index::groupid_t groupId) const
 {
     if (groupId >= _data.size()) {
@@ -30,8 +30,9 @@ public:
 
 public:
     void serialize(autil::DataBuffer& dataBuffer) const;
+    // values point into dataBuffer when copyData is false
     void deserialize(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool,
-                     uint32_t docVersion = DOCUMENT_BINARY_VERSION);
+                     uint32_t docVersion = DOCUMENT_BINARY_VERSION, bool copyData = true);
 
     bool operator==(const SerializedSourceDocument& doc) const
     {
@@ -59,6 +60,10 @@ public:
     autil::StringView _accessaryData;
     autil::StringView _nonExistFieldInfo;
 
+private:
+    static const char* ReadBytes(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool, uint32_t len,
+                                 bool copyData);
+
 private:
     AUTIL_LOG_DECLARE();
 };
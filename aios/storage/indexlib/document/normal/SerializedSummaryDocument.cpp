@@ -22,11 +22,19 @@ using namespace std;
 namespace indexlib { namespace document {
 AUTIL_LOG_SETUP(indexlib.document, SerializedSummaryDocument);
 
-SerializedSummaryDocument::SerializedSummaryDocument() : _value(NULL), _length(0), _docId(INVALID_DOCID) {}
+SerializedSummaryDocument::SerializedSummaryDocument()
+    : _value(NULL)
+    , _length(0)
+    , _docId(INVALID_DOCID)
+    , _ownValue(true)
+{
+}
 
 SerializedSummaryDocument::~SerializedSummaryDocument()
 {
-    delete[] _value;
+    if (_ownValue) {
+        delete[] _value;
+    }
     _value = NULL;
 }
 
@@ -35,6 +43,7 @@ void SerializedSummaryDocument::SetSerializedDoc(char* value, size_t length)
     assert(value);
     _value = value;
     _length = length;
+    _ownValue = true;
 }
 
 void SerializedSummaryDocument::Serialize(const std::shared_ptr<SerializedSummaryDocument>& summary, std::string& str)
@@ -107,10 +116,15 @@ void SerializedSummaryDocument::serialize(autil::DataBuffer& dataBuffer) const
     }
 }
 
-void SerializedSummaryDocument::deserialize(autil::DataBuffer& dataBuffer, uint32_t docVersion)
+void SerializedSummaryDocument::deserialize(autil::DataBuffer& dataBuffer, uint32_t docVersion, bool copyData)
 {
     dataBuffer.read(_length);
     if (_length > 0) {
+        if (!copyData) {
+            _value = (char*)dataBuffer.readNoCopy(_length);
+            _ownValue = false;
+            return;
+        }
         _value = new (nothrow) char[_length];
         dataBuffer.readBytes(_value, _length);
     }
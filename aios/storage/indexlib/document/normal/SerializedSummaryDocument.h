@@ -51,7 +51,9 @@ public:
 
     void serialize(autil::DataBuffer& dataBuffer) const;
 
-    void deserialize(autil::DataBuffer& dataBuffer, uint32_t docVersion = DOCUMENT_BINARY_VERSION);
+    // value points into dataBuffer when copyData is false
+    void deserialize(autil::DataBuffer& dataBuffer, uint32_t docVersion = DOCUMENT_BINARY_VERSION,
+                     bool copyData = true);
 
     static void Serialize(const std::shared_ptr<SerializedSummaryDocument>& summary, std::string& str);
 
@@ -62,6 +64,7 @@ private:
     char* _value;
     size_t _length;
     docid_t _docId;
+    bool _ownValue;
 
 private:
     AUTIL_LOG_DECLARE();
@@ -92,16 +92,16 @@ void SummaryDocument::serialize(DataBuffer& dataBuffer) const
     }
 }
 
-void SummaryDocument::deserialize(DataBuffer& dataBuffer, Pool* pool)
+void SummaryDocument::deserialize(DataBuffer& dataBuffer, Pool* pool, bool copyData)
 {
     Reset();
     bool partialSerialize;
     dataBuffer.read(partialSerialize);
 
     if (partialSerialize) {
-        DeserializeNotEmptyFields(dataBuffer, pool);
+        DeserializeNotEmptyFields(dataBuffer, pool, copyData);
     } else {
-        DeserializeAllFields(dataBuffer, pool);
+        DeserializeAllFields(dataBuffer, pool, copyData);
     }
 }
 
@@ -110,7 +110,7 @@ void SummaryDocument::deserializeLegacyFormat(DataBuffer& dataBuffer, Pool* pool
     deserialize(dataBuffer, pool);
 }
 
-void SummaryDocument::DeserializeAllFields(DataBuffer& dataBuffer, Pool* pool)
+void SummaryDocument::DeserializeAllFields(DataBuffer& dataBuffer, Pool* pool, bool copyData)
 {
     uint32_t fieldCount;
     dataBuffer.read(fieldCount);
@@ -119,7 +119,7 @@ void SummaryDocument::DeserializeAllFields(DataBuffer& dataBuffer, Pool* pool)
     uint32_t emptyFieldCount = 0;
     for (uint32_t i = 0; i < fieldCount; ++i) {
         StringView value;
-        dataBuffer.read(value, pool);
+        ReadField(dataBuffer, pool, copyData, value);
         _fields[i] = value;
 
         if (value.empty()) {
@@ -131,7 +131,7 @@ void SummaryDocument::DeserializeAllFields(DataBuffer& dataBuffer, Pool* pool)
     _notEmptyFieldCount = fieldCount - emptyFieldCount;
 }
 
-void SummaryDocument::DeserializeNotEmptyFields(DataBuffer& dataBuffer, Pool* pool)
+void SummaryDocument::DeserializeNotEmptyFields(DataBuffer& dataBuffer, Pool* pool, bool copyData)
 {
     uint32_t fieldCount;
     dataBuffer.read(fieldCount);
@@ -144,7 +144,7 @@ void SummaryDocument::DeserializeNotEmptyFields(DataBuffer& dataBuffer, Pool* po
         }
 
         StringView value;
-        dataBuffer.read(value, pool);
+        ReadField(dataBuffer, pool, copyData, value);
         _fields[fieldId] = value;
 
         if (!value.empty()) {
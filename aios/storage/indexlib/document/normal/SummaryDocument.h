@@ -108,7 +108,8 @@ public:
     Iterator CreateIterator() const { return Iterator(_fields, _firstNotEmptyFieldId); }
 
     void serialize(autil::DataBuffer& dataBuffer) const;
-    void deserialize(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool);
+    // fields point into dataBuffer when copyData is false
+    void deserialize(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool, bool copyData = true);
 
     void deserializeLegacyFormat(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool, uint32_t docVersion);
 
@@ -117,8 +118,17 @@ public:
 
 private:
     bool NeedPartialSerialize() const;
-    void DeserializeAllFields(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool);
-    void DeserializeNotEmptyFields(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool);
+    void DeserializeAllFields(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool, bool copyData);
+    void DeserializeNotEmptyFields(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool, bool copyData);
+    static void ReadField(autil::DataBuffer& dataBuffer, autil::mem_pool::Pool* pool, bool copyData,
+                          autil::StringView& value)
+    {
+        if (copyData) {
+            dataBuffer.read(value, pool);
+        } else {
+            dataBuffer.read(value);
+        }
+    }
 
 private:
     FieldVector _fields;
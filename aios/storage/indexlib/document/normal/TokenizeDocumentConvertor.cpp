@@ -117,6 +117,35 @@ TokenizeDocumentConvertor::Convert(RawDocument* rawDoc, const std::map<fieldid_t
     return Status::OK();
 }
 
+void TokenizeDocumentConvertor::BatchConvert(std::vector<BatchItem>& batchItems)
+{
+    auto fieldCount = _schema->GetFieldCount();
+    for (auto& item : batchItems) {
+        item.tokenizeDocument->reserve(fieldCount);
+        item.lastTokenizeDocument->reserve(fieldCount);
+        item.success = true;
+    }
+    AnalyzerCache analyzerCache;
+    const auto& fieldConfigs = _schema->GetFieldConfigs();
+    for (const auto& fieldConfig : fieldConfigs) {
+        const std::string& fieldName = fieldConfig->GetFieldName();
+        const std::string lastFieldName = LAST_VALUE_PREFIX + fieldName;
+        analyzerCache.clear();
+        for (auto& item : batchItems) {
+            if (!item.success) {
+                continue;
+            }
+            std::string specifyAnalyzerName = GetAnalyzerName(fieldConfig->GetFieldId(), *item.fieldAnalyzerNameMap);
+            if (!ProcessField(item.rawDoc, fieldConfig, fieldName, specifyAnalyzerName, item.tokenizeDocument,
+                              &analyzerCache) ||
+                !ProcessLastField(item.rawDoc, fieldConfig, lastFieldName, specifyAnalyzerName,
+                                  item.lastTokenizeDocument, &analyzerCache)) {
+                item.success = false;
+            }
+        }
+    }
+}
+
 std::string TokenizeDocumentConvertor::GetAnalyzerName(fieldid_t fieldId,
                                                        const std::map<fieldid_t, std::string>& fieldAnalyzerNameMap)
 {
@@ -131,18 +160,20 @@ std::string TokenizeDocumentConvertor::GetAnalyzerName(fieldid_t fieldId,
 bool TokenizeDocumentConvertor::ProcessLastField(const RawDocument* rawDocument,
                                                  const std::shared_ptr<indexlibv2::config::FieldConfig>& fieldConfig,
                                                  const std::string& fieldName, const std::string& specifyAnalyzerName,
-                                                 const indexlib::document::TokenizeDocumentPtr& tokenizeDocument)
+                                                 const indexlib::document::TokenizeDocumentPtr& tokenizeDocument,
+                                                 AnalyzerCache* analyzerCache)
 {
     if (!rawDocument->exist(fieldName)) {
         return true;
     }
-    return ProcessField(rawDocument, fieldConfig, fieldName, specifyAnalyzerName, tokenizeDocument);
+    return ProcessField(rawDocument, fieldConfig, fieldName, specifyAnalyzerName, tokenizeDocument, analyzerCache);
 }
 
 bool TokenizeDocumentConvertor::ProcessField(const RawDocument* rawDocument,
                                              const std::shared_ptr<indexlibv2::config::FieldConfig>& fieldConfig,
                                              const std::string& fieldName, const std::string& specifyAnalyzerName,
-                                             const indexlib::document::TokenizeDocumentPtr& tokenizeDocument)
+                                             const indexlib::document::TokenizeDocumentPtr& tokenizeDocument,
+                                             AnalyzerCache* analyzerCache)
 {
     FieldType fieldType = fieldConfig->GetFieldType();
     if (fieldType == ft_raw) {
@@ -174,7 +205,7 @@ bool TokenizeDocumentConvertor::ProcessField(const RawDocument* rawDocument,
     }
     bool ret = true;
     if (ft_text == fieldType) {
-        ret = TokenizeTextField(field, fieldValue, specifyAnalyzerName);
+        ret = TokenizeTextField(field, fieldValue, specifyAnalyzerName, analyzerCache);
     } else if (ft_location == fieldType || ft_line == fieldType || ft_polygon == fieldType) {
         ret = TokenizeSingleValueField(field, fieldValue);
     } else if (fieldConfig->IsMultiValue() && IsInIndex(fieldId)) {
@@ -229,14 +260,26 @@ Analyzer* TokenizeDocumentConvertor::CreateSimpleAnalyzer(const std::string& del
 
 bool TokenizeDocumentConvertor::TokenizeTextField(const indexlib::document::TokenizeFieldPtr& field,
                                                   const autil::StringView& fieldValue,
-                                                  const std::string& fieldAnalyzerName)
+                                                  const std::string& fieldAnalyzerName,
+                                                  AnalyzerCache* analyzerCache)
 {
     if (fieldValue.empty()) {
         return true;
     }
 
     fieldid_t fieldId = field->getFieldId();
-    Analyzer* analyzer = GetAnalyzer(fieldId, fieldAnalyzerName);
+    std::unique_ptr<Analyzer> ownedAnalyzer;
+    Analyzer* analyzer = nullptr;
+    if (analyzerCache) {
+        auto& cachedAnalyzer = (*analyzerCache)[fieldAnalyzerName];
+        if (!cachedAnalyzer) {
+            cachedAnalyzer.reset(GetAnalyzer(fieldId, fieldAnalyzerName));
+        }
+        analyzer = cachedAnalyzer.get();
+    } else {
+        ownedAnalyzer.reset(GetAnalyzer(fieldId, fieldAnalyzerName));
+        analyzer = ownedAnalyzer.get();
+    }
     if (!analyzer) {
         std::stringstream ss;
         ss << "Get analyzer FAIL, fieldId = [" << fieldId << "]";
@@ -244,9 +287,7 @@ bool TokenizeDocumentConvertor::TokenizeTextField(const indexlib::document::Toke
         AUTIL_LOG(ERROR, "%s", errorMsg.c_str());
         return false;
     }
-    bool ret = DoTokenizeTextField(field, fieldValue, analyzer);
-    delete analyzer;
-    return ret;
+    return DoTokenizeTextField(field, fieldValue, analyzer);
 }
 
 bool TokenizeDocumentConvertor::DoTokenizeTextField(const indexlib::document::TokenizeFieldPtr& field,
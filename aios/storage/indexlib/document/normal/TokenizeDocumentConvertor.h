@@ -15,6 +15,10 @@
  */
 #pragma once
 
+#include <map>
+#include <memory>
+#include <vector>
+
 #include "autil/Log.h"
 #include "autil/NoCopyable.h"
 #include "indexlib/base/Constant.h"
@@ -50,6 +54,15 @@ public:
     TokenizeDocumentConvertor() = default;
     ~TokenizeDocumentConvertor() = default;
 
+public:
+    struct BatchItem {
+        RawDocument* rawDoc = nullptr;
+        const std::map<fieldid_t, std::string>* fieldAnalyzerNameMap = nullptr;
+        std::shared_ptr<indexlib::document::TokenizeDocument> tokenizeDocument;
+        std::shared_ptr<indexlib::document::TokenizeDocument> lastTokenizeDocument;
+        bool success = true;
+    };
+
 public:
     static const std::string LAST_VALUE_PREFIX;
     // analyzer factory
@@ -58,6 +71,11 @@ public:
     Status Convert(RawDocument* rawDoc, const std::map<fieldid_t, std::string>& fieldAnalyzerNameMap,
                    const std::shared_ptr<indexlib::document::TokenizeDocument>& tokenizeDocument,
                    const std::shared_ptr<indexlib::document::TokenizeDocument>& lastTokenizeDocument);
+    // tokenize docs field by field, analyzers of a field are created once for the whole batch.
+    void BatchConvert(std::vector<BatchItem>& batchItems);
+
+private:
+    typedef std::map<std::string, std::unique_ptr<analyzer::Analyzer>> AnalyzerCache;
 
 private:
     std::string GetAnalyzerName(fieldid_t fieldId, const std::map<fieldid_t, std::string>& fieldAnalyzerNameMap);
@@ -66,13 +84,15 @@ private:
     bool ProcessLastField(const RawDocument* rawDocument,
                           const std::shared_ptr<indexlibv2::config::FieldConfig>& fieldConfig,
                           const std::string& fieldName, const std::string& specifyAnalyzerName,
-                          const indexlib::document::TokenizeDocumentPtr& tokenizeDocument);
+                          const indexlib::document::TokenizeDocumentPtr& tokenizeDocument,
+                          AnalyzerCache* analyzerCache = nullptr);
     bool ProcessField(const RawDocument* rawDocument,
                       const std::shared_ptr<indexlibv2::config::FieldConfig>& fieldConfig, const std::string& fieldName,
                       const std::string& specifyAnalyzerName,
-                      const indexlib::document::TokenizeDocumentPtr& tokenizeDocument);
+                      const indexlib::document::TokenizeDocumentPtr& tokenizeDocument,
+                      AnalyzerCache* analyzerCache = nullptr);
     bool TokenizeTextField(const indexlib::document::TokenizeFieldPtr& field, const autil::StringView& fieldValue,
-                           const std::string& fieldAnalyzerName);
+                           const std::string& fieldAnalyzerName, AnalyzerCache* analyzerCache);
     bool TokenizeMultiValueField(const indexlib::document::TokenizeFieldPtr& field, const autil::StringView& fieldValue,
                                  const std::string& seperator);
     bool TokenizeSingleValueField(const indexlib::document::TokenizeFieldPtr& field,
@@ -78,6 +78,15 @@ public:
     virtual std::unique_ptr<AttributeIteratorBase> CreateSequentialIterator() const = 0;
     virtual bool GetSortedDocIdRange(const indexlib::index::RangeDescription& range, const DocIdRange& rangeLimit,
                                      DocIdRange& resultRange) const = 0;
+    // rangeLimit = [begin, end), resultRanges hold docs which may match range, skipped by block zone map.
+    // return false if not supported
+    virtual bool GetZoneMapDocIdRanges(const indexlib::index::RangeDescription& range, const DocIdRange& rangeLimit,
+                                       DocIdRangeVector& resultRanges) const
+    {
+        return false;
+    }
+    // return true if any built segment can skip blocks by zone map
+    virtual bool HasZoneMap() const { return false; }
     virtual std::string GetAttributeName() const = 0;
     virtual size_t EstimateLoadSize(const Segments& allSegments,
                                     const std::shared_ptr<config::IIndexConfig>& indexConfig,
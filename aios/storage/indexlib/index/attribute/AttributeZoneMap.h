@@ -0,0 +1,261 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "autil/Log.h"
+#include "autil/NoCopyable.h"
+#include "indexlib/base/Status.h"
+#include "indexlib/base/Types.h"
+#include "indexlib/file_system/IDirectory.h"
+#include "indexlib/index/attribute/Constant.h"
+#include "indexlib/index/attribute/config/AttributeConfig.h"
+
+namespace indexlibv2::index {
+
+// Per block min/max/null count of a single value attribute segment, stored beside the
+// attribute data as "zone_map". Range filters use it to skip blocks that can not match.
+// Updates only widen a block, so a zone is always a superset of the block values.
+// Update runs in the single attribute update thread while queries read zones, so zones
+// changed by Update are published under a seqlock and read by a consistent copy.
+template <typename T>
+class AttributeZoneMap : private autil::NoCopyable
+{
+public:
+    struct Zone {
+        T minValue;
+        T maxValue;
+        uint32_t valueCount; // not null docs, may over-estimate after update
+        uint32_t nullCount;  // may over-estimate after update
+    };
+
+    static constexpr uint32_t DEFAULT_BLOCK_DOC_COUNT = 1024;
+
+public:
+    explicit AttributeZoneMap(uint32_t blockDocCount = DEFAULT_BLOCK_DOC_COUNT)
+        : _blockDocCount(blockDocCount)
+        , _docCount(0)
+        , _updateSeq(0)
+    {
+        assert(_blockDocCount > 0);
+    }
+    ~AttributeZoneMap() = default;
+
+public:
+    static bool IsSupported(const std::shared_ptr<config::AttributeConfig>& attrConfig);
+
+    void Append(const T& value, bool isNull);
+    void Update(docid_t docId, const T& value, bool isNull);
+    // append sub ranges of rangeLimit = [begin, end) whose blocks may contain a value in [from, to]
+    void GetCandidateRanges(const T& from, const T& to, const DocIdRange& rangeLimit,
+                            DocIdRangeVector& resultRanges) const;
+
+    Status Store(const std::shared_ptr<indexlib::file_system::IDirectory>& directory) const;
+    Status Load(const std::shared_ptr<indexlib::file_system::IDirectory>& directory, bool& isExist);
+
+    uint32_t GetBlockDocCount() const { return _blockDocCount; }
+    uint64_t GetDocCount() const { return _docCount; }
+    size_t GetZoneCount() const { return _zones.size(); }
+    Zone GetZone(size_t zoneIdx) const { return ReadZone(zoneIdx); }
+    size_t EvaluateCurrentMemUsed() const { return _zones.capacity() * sizeof(Zone); }
+
+private:
+    struct Header {
+        uint32_t blockDocCount;
+        uint32_t valueSize;
+        uint64_t docCount;
+    };
+
+    static void AddToZone(Zone& zone, const T& value, bool isNull);
+    Zone ReadZone(size_t zoneIdx) const;
+    bool MayMatch(const Zone& zone, const T& from, const T& to) const
+    {
+        return zone.valueCount > 0 && !(zone.maxValue < from) && !(to < zone.minValue);
+    }
+
+private:
+    uint32_t _blockDocCount;
+    uint64_t _docCount;
+    std::vector<Zone> _zones;
+    std::atomic<uint64_t> _updateSeq; // odd while Update is changing a zone
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+AUTIL_LOG_SETUP_TEMPLATE(indexlib.index, AttributeZoneMap, T);
+
+template <typename T>
+inline bool AttributeZoneMap<T>::IsSupported(const std::shared_ptr<config::AttributeConfig>& attrConfig)
+{
+    if constexpr (!std::is_arithmetic_v<T>) {
+        return false;
+    } else {
+        if (!attrConfig || !attrConfig->IsZoneMapEnabled() || attrConfig->IsMultiValue()) {
+            return false;
+        }
+        // encoded float is not comparable with the raw value
+        auto compressType = attrConfig->GetCompressType();
+        return !compressType.HasFp16EncodeCompress() && !compressType.HasInt8EncodeCompress() &&
+               !compressType.HasBlockFpEncodeCompress();
+    }
+}
+
+template <typename T>
+inline void AttributeZoneMap<T>::AddToZone(Zone& zone, const T& value, bool isNull)
+{
+    if (isNull) {
+        ++zone.nullCount;
+        return;
+    }
+    if (zone.valueCount == 0) {
+        zone.minValue = value;
+        zone.maxValue = value;
+    } else {
+        zone.minValue = std::min(zone.minValue, value);
+        zone.maxValue = std::max(zone.maxValue, value);
+    }
+    ++zone.valueCount;
+}
+
+template <typename T>
+inline void AttributeZoneMap<T>::Append(const T& value, bool isNull)
+{
+    if (_docCount % _blockDocCount == 0) {
+        _zones.push_back(Zone {T(), T(), 0, 0});
+    }
+    AddToZone(_zones.back(), value, isNull);
+    ++_docCount;
+}
+
+template <typename T>
+inline void AttributeZoneMap<T>::Update(docid_t docId, const T& value, bool isNull)
+{
+    if (docId < 0 || (uint64_t)docId >= _docCount) {
+        return;
+    }
+    uint64_t seq = _updateSeq.load(std::memory_order_relaxed);
+    _updateSeq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    AddToZone(_zones[docId / _blockDocCount], value, isNull);
+    _updateSeq.store(seq + 2, std::memory_order_release);
+}
+
+template <typename T>
+inline typename AttributeZoneMap<T>::Zone AttributeZoneMap<T>::ReadZone(size_t zoneIdx) const
+{
+    Zone zone;
+    while (true) {
+        uint64_t seq = _updateSeq.load(std::memory_order_acquire);
+        if (seq & 1) {
+            continue;
+        }
+        memcpy((void*)&zone, (const void*)&_zones[zoneIdx], sizeof(Zone));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_updateSeq.load(std::memory_order_relaxed) == seq) {
+            return zone;
+        }
+    }
+}
+
+template <typename T>
+inline void AttributeZoneMap<T>::GetCandidateRanges(const T& from, const T& to, const DocIdRange& rangeLimit,
+                                                    DocIdRangeVector& resultRanges) const
+{
+    docid_t end = std::min((docid_t)_docCount, rangeLimit.second);
+    docid_t begin = std::max((docid_t)0, rangeLimit.first);
+    while (begin < end) {
+        size_t zoneIdx = begin / _blockDocCount;
+        docid_t blockEnd = std::min(end, (docid_t)((zoneIdx + 1) * _blockDocCount));
+        if (MayMatch(ReadZone(zoneIdx), from, to)) {
+            if (!resultRanges.empty() && resultRanges.back().second == begin) {
+                resultRanges.back().second = blockEnd;
+            } else {
+                resultRanges.emplace_back(begin, blockEnd);
+            }
+        }
+        begin = blockEnd;
+    }
+    // docs beyond the zone map are unknown, keep them
+    if (rangeLimit.second > (docid_t)_docCount) {
+        docid_t tailBegin = std::max(rangeLimit.first, (docid_t)_docCount);
+        if (!resultRanges.empty() && resultRanges.back().second == tailBegin) {
+            resultRanges.back().second = rangeLimit.second;
+        } else {
+            resultRanges.emplace_back(tailBegin, rangeLimit.second);
+        }
+    }
+}
+
+template <typename T>
+inline Status AttributeZoneMap<T>::Store(const std::shared_ptr<indexlib::file_system::IDirectory>& directory) const
+{
+    auto status =
+        directory->RemoveFile(ATTRIBUTE_ZONE_MAP_FILE_NAME, indexlib::file_system::RemoveOption::MayNonExist())
+            .Status();
+    RETURN_IF_STATUS_ERROR(status, "remove zone map file failed");
+    Header header {_blockDocCount, (uint32_t)sizeof(T), _docCount};
+    std::string content;
+    content.reserve(sizeof(header) + _zones.size() * sizeof(Zone));
+    content.append((const char*)&header, sizeof(header));
+    content.append((const char*)_zones.data(), _zones.size() * sizeof(Zone));
+    return directory
+        ->Store(ATTRIBUTE_ZONE_MAP_FILE_NAME, content, indexlib::file_system::WriterOption::AtomicDump())
+        .Status();
+}
+
+template <typename T>
+inline Status AttributeZoneMap<T>::Load(const std::shared_ptr<indexlib::file_system::IDirectory>& directory,
+                                        bool& isExist)
+{
+    Status status;
+    std::tie(status, isExist) = directory->IsExist(ATTRIBUTE_ZONE_MAP_FILE_NAME).StatusWith();
+    RETURN_IF_STATUS_ERROR(status, "check zone map in [%s] failed", directory->DebugString().c_str());
+    if (!isExist) {
+        return Status::OK();
+    }
+    std::string content;
+    status = directory
+                 ->Load(ATTRIBUTE_ZONE_MAP_FILE_NAME,
+                        indexlib::file_system::ReaderOption(indexlib::file_system::FSOT_MEM), content)
+                 .Status();
+    RETURN_IF_STATUS_ERROR(status, "load zone map from [%s] failed", directory->DebugString().c_str());
+    if (content.size() < sizeof(Header)) {
+        RETURN_STATUS_ERROR(Corruption, "zone map in [%s] is truncated", directory->DebugString().c_str());
+    }
+    Header header;
+    memcpy(&header, content.data(), sizeof(header));
+    size_t zoneCount = (content.size() - sizeof(header)) / sizeof(Zone);
+    if (header.valueSize != sizeof(T) || header.blockDocCount == 0 ||
+        (content.size() - sizeof(header)) % sizeof(Zone) != 0 ||
+        zoneCount != (header.docCount + header.blockDocCount - 1) / header.blockDocCount) {
+        RETURN_STATUS_ERROR(Corruption, "zone map in [%s] is corrupted", directory->DebugString().c_str());
+    }
+    _blockDocCount = header.blockDocCount;
+    _docCount = header.docCount;
+    _zones.resize(zoneCount);
+    memcpy((void*)_zones.data(), content.data() + sizeof(header), zoneCount * sizeof(Zone));
+    return Status::OK();
+}
+
+} // namespace indexlibv2::index
@@ -26,6 +26,7 @@ constexpr uint32_t ATTRIBUTE_U32OFFSET_THRESHOLD_MAX = 0xFFFFFFFFL;
 inline const std::string ATTRIBUTE_DATA_FILE_NAME = "data";
 inline const std::string ATTRIBUTE_OFFSET_FILE_NAME = "offset";
 inline const std::string ATTRIBUTE_DATA_INFO_FILE_NAME = "data_info";
+inline const std::string ATTRIBUTE_ZONE_MAP_FILE_NAME = "zone_map";
 inline const std::string ATTRIBUTE_DATA_EXTEND_SLICE_FILE_NAME = "extend_slice_data";
 inline const std::string ATTRIBUTE_OFFSET_EXTEND_SUFFIX = ".extend64";
 inline const std::string ATTRIBUTE_EQUAL_COMPRESS_UPDATE_EXTEND_SUFFIX = ".extend_equal_compress";
@@ -35,6 +36,7 @@ inline const std::string ATTRIBUTE_U32OFFSET_THRESHOLD = "u32offset_threshold";
 inline const std::string ATTRIBUTE_COMPRESS_TYPE = "compress_type";
 inline const std::string ATTRIBUTE_SLICE_COUNT = "slice_count";
 inline const std::string ATTRIBUTE_SLICE_IDX = "slice_idx";
+inline const std::string ATTRIBUTE_ENABLE_ZONE_MAP = "enable_zone_map";
 } // namespace indexlib::index
 
 namespace indexlib {
@@ -48,8 +50,10 @@ namespace indexlibv2::index {
 using indexlib::index::ATTRIBUTE_DATA_EXTEND_SLICE_FILE_NAME;
 using indexlib::index::ATTRIBUTE_DATA_FILE_NAME;
 using indexlib::index::ATTRIBUTE_DATA_INFO_FILE_NAME;
+using indexlib::index::ATTRIBUTE_ZONE_MAP_FILE_NAME;
 using indexlib::index::ATTRIBUTE_DEFAULT_DEFRAG_SLICE_PERCENT;
 using indexlib::index::ATTRIBUTE_DEFRAG_SLICE_PERCENT;
+using indexlib::index::ATTRIBUTE_ENABLE_ZONE_MAP;
 using indexlib::index::ATTRIBUTE_EQUAL_COMPRESS_UPDATE_EXTEND_SUFFIX;
 using indexlib::index::ATTRIBUTE_OFFSET_EXTEND_SUFFIX;
 using indexlib::index::ATTRIBUTE_OFFSET_FILE_NAME;
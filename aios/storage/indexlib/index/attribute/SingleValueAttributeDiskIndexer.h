@@ -35,6 +35,7 @@
 #include "indexlib/file_system/stream/FileStream.h"
 #include "indexlib/index/attribute/AttributeDiskIndexerCreator.h"
 #include "indexlib/index/attribute/AttributeMetrics.h"
+#include "indexlib/index/attribute/AttributeZoneMap.h"
 #include "indexlib/index/attribute/Common.h"
 #include "indexlib/index/attribute/SingleValueAttributeCompressReader.h"
 #include "indexlib/index/attribute/SingleValueAttributeUnCompressReader.h"
@@ -139,6 +140,11 @@ public:
     template <class Compare>
     Status Search(T value, const DocIdRange& rangeLimit, const config::SortPattern& sortType, docid_t& docId) const;
     int32_t SearchNullCount(const config::SortPattern& sortType) const;
+    // rangeLimit = [begin, end) in segment, append sub ranges which may hold values in [from, to],
+    // return false if segment has no zone map
+    bool GetZoneMapDocIdRanges(const T& from, const T& to, const DocIdRange& rangeLimit,
+                               DocIdRangeVector& resultRanges) const;
+    bool HasZoneMap() const { return _zoneMap && _patch == nullptr; }
 
 public:
     uint32_t TEST_GetDataLength(docid_t docId, autil::mem_pool::Pool*) const override;
@@ -151,6 +157,7 @@ private:
 protected:
     std::unique_ptr<SingleValueAttributeCompressReader<T>> _compressReader;
     std::unique_ptr<SingleValueAttributeUnCompressReader<T>> _unCompressReader;
+    std::unique_ptr<AttributeZoneMap<T>> _zoneMap;
     AttributeReaderType _attrReaderType = AttributeReaderType::UNKNOWN;
 
 private:
@@ -221,6 +228,14 @@ SingleValueAttributeDiskIndexer<T>::Open(const std::shared_ptr<config::IIndexCon
             status = _unCompressReader->Open(_attrConfig, fieldDir, sliceDocCount, _indexerParam.segmentId);
         }
         RETURN_IF_STATUS_ERROR(status, "open SingleValueAttributeReader fail, type[%d]", (int)_attrReaderType);
+        if (AttributeZoneMap<T>::IsSupported(_attrConfig)) {
+            auto zoneMap = std::make_unique<AttributeZoneMap<T>>();
+            status = zoneMap->Load(fieldDir, isExist);
+            RETURN_IF_STATUS_ERROR(status, "load zone map fail, segId[%d]", _indexerParam.segmentId);
+            if (isExist && zoneMap->GetDocCount() == (uint64_t)sliceDocCount) {
+                _zoneMap = std::move(zoneMap);
+            }
+        }
     }
     AUTIL_LOG(INFO, "Finishing loading segment(%d) for attribute(%s), used[%.3f]s", _indexerParam.segmentId,
               attrPath.c_str(), timer.done_sec());
@@ -235,6 +250,9 @@ size_t SingleValueAttributeDiskIndexer<T>::EvaluateCurrentMemUsed()
         return totalMemUsed;
     }
     DISPATCH(EvaluateCurrentMemUsed, totalMemUsed);
+    if (_zoneMap) {
+        totalMemUsed += _zoneMap->EvaluateCurrentMemUsed();
+    }
     return totalMemUsed;
 }
 
@@ -321,6 +339,10 @@ inline bool SingleValueAttributeDiskIndexer<T>::UpdateField(docid_t docId, const
 {
     auto buf = (uint8_t*)value.data();
     auto bufLen = value.size();
+    if (_zoneMap && (isNull || bufLen >= sizeof(T))) {
+        // widen zone before data changes, readers never skip the new value
+        _zoneMap->Update(docId, isNull ? T() : *(T*)buf, isNull);
+    }
     if (_attrReaderType == AttributeReaderType::COMPRESS_READER) {
         return _compressReader->UpdateField(docId, buf, bufLen);
     } else if (_attrReaderType == AttributeReaderType::UNCOMPRESS_READER) {
@@ -460,6 +482,19 @@ int32_t SingleValueAttributeDiskIndexer<T>::SearchNullCount(const config::SortPa
     return 0;
 }
 
+template <typename T>
+bool SingleValueAttributeDiskIndexer<T>::GetZoneMapDocIdRanges(const T& from, const T& to,
+                                                               const DocIdRange& rangeLimit,
+                                                               DocIdRangeVector& resultRanges) const
+{
+    // values in patch reader are not covered by zone map
+    if (!HasZoneMap()) {
+        return false;
+    }
+    _zoneMap->GetCandidateRanges(from, to, rangeLimit, resultRanges);
+    return true;
+}
+
 template <typename T>
 bool SingleValueAttributeDiskIndexer<T>::Updatable() const
 {
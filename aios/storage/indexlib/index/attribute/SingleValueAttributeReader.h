@@ -16,6 +16,7 @@
 #pragma once
 #include <algorithm>
 #include <functional>
+#include <limits>
 
 #include "autil/Log.h"
 #include "indexlib/base/Define.h"
@@ -70,6 +71,9 @@ public:
     // rangeLimit = [begin, end), resultRange = [begin, end)
     bool GetSortedDocIdRange(const indexlib::index::RangeDescription& range, const DocIdRange& rangeLimit,
                              DocIdRange& resultRange) const override;
+    bool GetZoneMapDocIdRanges(const indexlib::index::RangeDescription& range, const DocIdRange& rangeLimit,
+                               DocIdRangeVector& resultRanges) const override;
+    bool HasZoneMap() const override;
     std::string GetAttributeName() const override;
     std::shared_ptr<AttributeDiskIndexer> GetIndexer(docid_t docId) const override;
     void EnableAccessCountors() override;
@@ -167,6 +171,77 @@ inline bool SingleValueAttributeReader<autil::uint128_t>::GetSortedDocIdRange(
     return false;
 }
 
+template <typename T>
+inline bool SingleValueAttributeReader<T>::GetZoneMapDocIdRanges(const indexlib::index::RangeDescription& range,
+                                                                 const DocIdRange& rangeLimit,
+                                                                 DocIdRangeVector& resultRanges) const
+{
+    T from = std::numeric_limits<T>::lowest();
+    T to = std::numeric_limits<T>::max();
+    if (range.from != indexlib::index::RangeDescription::INFINITE &&
+        !autil::StringUtil::fromString(range.from, from)) {
+        return false;
+    }
+    if (range.to != indexlib::index::RangeDescription::INFINITE && !autil::StringUtil::fromString(range.to, to)) {
+        return false;
+    }
+    if (to < from) {
+        std::swap(from, to);
+    }
+
+    auto appendRange = [&resultRanges](docid_t begin, docid_t end) {
+        if (!resultRanges.empty() && resultRanges.back().second == begin) {
+            resultRanges.back().second = end;
+        } else {
+            resultRanges.emplace_back(begin, end);
+        }
+    };
+    resultRanges.clear();
+    docid_t begin = rangeLimit.first;
+    docid_t baseDocId = 0;
+    for (size_t i = 0; i < _segmentDocCount.size() && begin < rangeLimit.second; ++i) {
+        docid_t segEnd = baseDocId + (docid_t)_segmentDocCount[i];
+        if (begin < segEnd) {
+            docid_t end = std::min(segEnd, rangeLimit.second);
+            DocIdRangeVector segRanges;
+            if (_onDiskIndexers[i]->GetZoneMapDocIdRanges(from, to, {begin - baseDocId, end - baseDocId},
+                                                          segRanges)) {
+                for (const auto& segRange : segRanges) {
+                    appendRange(segRange.first + baseDocId, segRange.second + baseDocId);
+                }
+            } else {
+                appendRange(begin, end);
+            }
+            begin = end;
+        }
+        baseDocId = segEnd;
+    }
+    // building segments have no zone map
+    if (begin < rangeLimit.second) {
+        appendRange(begin, rangeLimit.second);
+    }
+    return true;
+}
+
+template <>
+inline bool SingleValueAttributeReader<autil::uint128_t>::GetZoneMapDocIdRanges(
+    const indexlib::index::RangeDescription& range, const DocIdRange& rangeLimit,
+    DocIdRangeVector& resultRanges) const
+{
+    return false;
+}
+
+template <typename T>
+inline bool SingleValueAttributeReader<T>::HasZoneMap() const
+{
+    for (const auto& indexer : _onDiskIndexers) {
+        if (indexer->HasZoneMap()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template <typename T>
 std::string SingleValueAttributeReader<T>::GetAttributeName() const
 {
@@ -43,6 +43,8 @@ struct AttributeConfig::Impl {
     indexlib::IndexStatus status = indexlib::is_normal;
     bool updatable = true; // need initialize by FieldConfig
     int64_t sliceCount = 1;
+    // dump per block min/max of single value attribute for range skipping
+    bool enableZoneMap = false;
     // not jsonize, no sliceIdx means no slice
     int64_t sliceIdx = -1;
 };
@@ -72,6 +74,8 @@ void AttributeConfig::Init(const std::shared_ptr<FieldConfig>& fieldConfig)
 
 int64_t AttributeConfig::GetSliceCount() const { return _impl->sliceCount; }
 int64_t AttributeConfig::GetSliceIdx() const { return _impl->sliceIdx; }
+bool AttributeConfig::IsZoneMapEnabled() const { return _impl->enableZoneMap; }
+void AttributeConfig::SetZoneMapEnabled(bool enable) { _impl->enableZoneMap = enable; }
 
 void AttributeConfig::Deserialize(const autil::legacy::Any& any, size_t idxInJsonArray,
                                   const config::IndexConfigDeserializeResource& resource)
@@ -112,6 +116,7 @@ void AttributeConfig::Deserialize(const autil::legacy::Any& any, size_t idxInJso
     json.Jsonize(index::ATTRIBUTE_DEFRAG_SLICE_PERCENT, _impl->defragSlicePercent, _impl->defragSlicePercent);
     json.Jsonize(index::ATTRIBUTE_UPDATABLE, _impl->updatable, _impl->updatable);
     json.Jsonize(index::ATTRIBUTE_SLICE_COUNT, _impl->sliceCount, _impl->sliceCount);
+    json.Jsonize(index::ATTRIBUTE_ENABLE_ZONE_MAP, _impl->enableZoneMap, _impl->enableZoneMap);
 }
 
 void AttributeConfig::Serialize(autil::legacy::Jsonizable::JsonWrapper& json) const
@@ -139,6 +144,9 @@ void AttributeConfig::Serialize(autil::legacy::Jsonizable::JsonWrapper& json) co
     if (_impl->sliceCount > 1) {
         json.Jsonize(index::ATTRIBUTE_SLICE_COUNT, _impl->sliceCount);
     }
+    if (_impl->enableZoneMap) {
+        json.Jsonize(index::ATTRIBUTE_ENABLE_ZONE_MAP, _impl->enableZoneMap);
+    }
 }
 
 const std::string& AttributeConfig::GetIndexType() const
@@ -367,6 +375,7 @@ std::shared_ptr<AttributeConfig> AttributeConfig::Clone()
     attrConfig->_impl->status = _impl->status;
     attrConfig->_impl->updatable = _impl->updatable;
     attrConfig->_impl->sliceCount = _impl->sliceCount;
+    attrConfig->_impl->enableZoneMap = _impl->enableZoneMap;
     return attrConfig;
 }
 
@@ -91,6 +91,7 @@ public:
     indexlib::IndexStatus GetStatus() const;
     int64_t GetSliceCount() const;
     int64_t GetSliceIdx() const;
+    bool IsZoneMapEnabled() const;
     std::vector<std::shared_ptr<AttributeConfig>> CreateSliceAttributeConfigs(int64_t sliceCount);
 
 public:
@@ -103,6 +104,7 @@ public:
     void SetFileCompressConfigV2(const std::shared_ptr<FileCompressConfigV2>& fileCompressConfigV2);
     void SetU32OffsetThreshold(uint64_t offsetThreshold);
     void SetDefragSlicePercent(uint64_t percent);
+    void SetZoneMapEnabled(bool enable);
     void Disable();
     Status Delete();
 
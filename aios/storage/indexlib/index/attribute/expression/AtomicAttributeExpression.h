@@ -47,7 +47,7 @@ public:
 
 public:
     void evaluate(const matchdoc::MatchDoc& matchDoc) override;
-    void batchEvaluate(matchdoc::MatchDoc* matchDocs, uint32_t docCount) override { assert(false); }
+    void batchEvaluate(matchdoc::MatchDoc* matchDocs, uint32_t docCount) override;
     Status InitPrefetcher(TabletSessionResource* resource) override;
     Status Prefetch(const matchdoc::MatchDoc& matchDoc) override;
 
@@ -60,6 +60,8 @@ private:
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+AUTIL_LOG_SETUP_TEMPLATE(indexlib.index, AtomicAttributeExpression, T);
+
 template <typename T>
 Status AtomicAttributeExpression<T>::InitPrefetcher(TabletSessionResource* resource)
 {
@@ -82,4 +84,22 @@ void AtomicAttributeExpression<T>::evaluate(const matchdoc::MatchDoc& matchDoc)
     this->storeValue(matchDoc, value);
 }
 
+template <typename T>
+void AtomicAttributeExpression<T>::batchEvaluate(matchdoc::MatchDoc* matchDocs, uint32_t docCount)
+{
+    std::vector<docid_t> docIds(docCount);
+    for (uint32_t i = 0; i < docCount; ++i) {
+        docIds[i] = matchDocs[i].getDocId();
+    }
+    std::vector<T> values;
+    auto status = _prefetcher.BatchPrefetch(docIds, values);
+    if (!status.IsOK()) {
+        AUTIL_LOG(ERROR, "batch evaluate attribute [%s] failed", _attrConfig->GetAttrName().c_str());
+        values.assign(docCount, T());
+    }
+    for (uint32_t i = 0; i < docCount; ++i) {
+        this->storeValue(matchDocs[i], values[i]);
+    }
+}
+
 } // namespace indexlibv2::index
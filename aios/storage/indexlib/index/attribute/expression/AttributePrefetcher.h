@@ -37,6 +37,8 @@ public:
     Status Init(autil::mem_pool::Pool* pool, const std::shared_ptr<config::AttributeConfig>& attrConfig,
                 std::vector<std::shared_ptr<framework::Segment>> segments);
     Status Prefetch(docid_t docId);
+    // seek values of docIds in one batch, sorted docIds are read segment by segment
+    Status BatchPrefetch(const std::vector<docid_t>& docIds, std::vector<T>& values);
     T GetValue() const { return _currentValue.second; }
     docid_t GetCurrentDocId() const { return _currentValue.first; }
 
@@ -102,4 +104,35 @@ Status AttributePrefetcher<T>::Prefetch(docid_t docId)
     return Status::OK();
 }
 
+template <typename T>
+Status AttributePrefetcher<T>::BatchPrefetch(const std::vector<docid_t>& docIds, std::vector<T>& values)
+{
+    values.resize(docIds.size());
+    if (docIds.empty()) {
+        return Status::OK();
+    }
+    if (!std::is_sorted(docIds.begin(), docIds.end())) {
+        for (size_t i = 0; i < docIds.size(); ++i) {
+            T value = T();
+            if (!_attrIterator->Seek(docIds[i], value)) {
+                AUTIL_LOG(ERROR, "batch prefetch docid [%d] failed, seek failed", docIds[i]);
+                return Status::Corruption("batch prefetch failed");
+            }
+            values[i] = value;
+        }
+        return Status::OK();
+    }
+    std::vector<bool> isNullVec;
+    auto ecVec = future_lite::coro::syncAwait(
+        _attrIterator->BatchSeek(docIds, indexlib::file_system::ReadOption(), &values, &isNullVec));
+    for (size_t i = 0; i < ecVec.size(); ++i) {
+        if (ecVec[i] != indexlib::index::ErrorCode::OK) {
+            AUTIL_LOG(ERROR, "batch prefetch docid [%d] failed, ec [%d]", docIds[i], (int)ecVec[i]);
+            return Status::Corruption("batch prefetch failed");
+        }
+    }
+    _currentValue = std::make_pair(docIds.back(), values.back());
+    return Status::OK();
+}
+
 } // namespace indexlibv2::index
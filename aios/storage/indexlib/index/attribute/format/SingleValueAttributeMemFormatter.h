@@ -25,6 +25,7 @@
 #include "indexlib/file_system/IDirectory.h"
 #include "indexlib/file_system/file/CompressFileWriter.h"
 #include "indexlib/index/DocMapDumpParams.h"
+#include "indexlib/index/attribute/AttributeZoneMap.h"
 #include "indexlib/index/attribute/config/AttributeConfig.h"
 #include "indexlib/index/attribute/format/SingleEncodedNullValue.h"
 #include "indexlib/index/common/FileCompressParamHelper.h"
@@ -77,6 +78,8 @@ private:
     template <bool SupportNull, bool IsSortDump>
     Status DumpUncompressedFileImpl(const std::shared_ptr<indexlib::file_system::FileWriter>& dataFile,
                                     std::vector<docid_t>* new2old);
+    Status DumpZoneMap(const std::shared_ptr<indexlib::file_system::IDirectory>& dir,
+                       const std::shared_ptr<framework::DumpParams>& dumpParams) const;
 
 private:
     std::shared_ptr<config::AttributeConfig> _attrConfig;
@@ -191,8 +194,34 @@ Status SingleValueAttributeMemFormatter<T>::Dump(const std::shared_ptr<indexlib:
         AUTIL_LOG(ERROR, "make subdir [%s] fail, ErrorInfo: [%s]. ", attributeName.c_str(), st.ToString().c_str());
         return st;
     }
-    return DumpFile(indexlib::file_system::IDirectory::ToLegacyDirectory(subDir), ATTRIBUTE_DATA_FILE_NAME, dumpPool,
-                    dumpParams);
+    st = DumpFile(indexlib::file_system::IDirectory::ToLegacyDirectory(subDir), ATTRIBUTE_DATA_FILE_NAME, dumpPool,
+                  dumpParams);
+    if (!st.IsOK() || !AttributeZoneMap<T>::IsSupported(_attrConfig)) {
+        return st;
+    }
+    return DumpZoneMap(subDir, dumpParams);
+}
+
+template <typename T>
+Status
+SingleValueAttributeMemFormatter<T>::DumpZoneMap(const std::shared_ptr<indexlib::file_system::IDirectory>& dir,
+                                                 const std::shared_ptr<framework::DumpParams>& dumpParams) const
+{
+    auto params = std::dynamic_pointer_cast<DocMapDumpParams>(dumpParams);
+    std::vector<docid_t>* new2old = params ? &params->new2old : nullptr;
+    AttributeZoneMap<T> zoneMap;
+    for (uint32_t i = 0; i < _data->Size(); ++i) {
+        docid_t docId = new2old ? new2old->at(i) : (docid_t)i;
+        T value {};
+        bool isNull = false;
+        Read(docId, value, isNull);
+        zoneMap.Append(value, isNull);
+    }
+    auto status = zoneMap.Store(dir);
+    if (!status.IsOK()) {
+        AUTIL_LOG(ERROR, "fail to dump zone map, ErrorInfo: [%s]", status.ToString().c_str());
+    }
+    return status;
 }
 
 template <typename T>
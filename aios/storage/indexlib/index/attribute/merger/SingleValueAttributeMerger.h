@@ -23,6 +23,7 @@
 #include "indexlib/file_system/file/FileWriter.h"
 #include "indexlib/index/DocMapper.h"
 #include "indexlib/index/attribute/AttributeDiskIndexerCreator.h"
+#include "indexlib/index/attribute/AttributeZoneMap.h"
 #include "indexlib/index/attribute/Common.h"
 #include "indexlib/index/attribute/SingleValueAttributeDiskIndexer.h"
 #include "indexlib/index/attribute/SliceInfo.h"
@@ -71,6 +72,8 @@ private:
         size_t outputIdx = 0;
         std::shared_ptr<AttributeFormatter> formatter;
         std::shared_ptr<SingleValueDataAppender> dataAppender;
+        std::shared_ptr<AttributeZoneMap<T>> zoneMap;
+        std::shared_ptr<indexlib::file_system::IDirectory> dataDir;
 
         OutputData() = default;
 
@@ -82,6 +85,9 @@ private:
             assert(dataAppender);
             assert(dataAppender->GetTotalCount() == (uint32_t)(globalDocId));
             dataAppender->Append(value, isNull);
+            if (zoneMap) {
+                zoneMap->Append(value, isNull);
+            }
         }
 
         bool BufferFull() const
@@ -111,6 +117,7 @@ private:
                               const std::vector<std::shared_ptr<framework::SegmentMeta>>& targetSegmentMetas);
     void DestroyBuffers();
     void CloseFiles();
+    Status DumpZoneMaps();
 
     Status MergePatches(const SegmentMergeInfos segmentMergeInfos);
     Status CreateDiskIndexers(const SegmentMergeInfos& segMergeInfos,
@@ -199,6 +206,8 @@ Status SingleValueAttributeMerger<T>::DoMerge(const SegmentMergeInfos& segMergeI
     }
 
     CloseFiles();
+    status = DumpZoneMaps();
+    RETURN_IF_STATUS_ERROR(status, "dump zone map failed.");
     DestroyBuffers();
 
     status = MergePatches(segMergeInfos);
@@ -282,6 +291,13 @@ Status SingleValueAttributeMerger<T>::PrepareOutputDatas(
             return Status::InternalError();
         }
         output.dataAppender->Init(DEFAULT_RECORD_COUNT, fileWriter);
+        if (AttributeZoneMap<T>::IsSupported(_attributeConfig)) {
+            std::string attrPath = _attributeConfig->GetAttrName() + "/" + _attributeConfig->GetSliceDir();
+            auto [dirStatus, dataDir] = attrDir->GetDirectory(attrPath).StatusWith();
+            RETURN_IF_STATUS_ERROR(dirStatus, "get attribute dir [%s] failed", attrPath.c_str());
+            output.dataDir = dataDir;
+            output.zoneMap = std::make_shared<AttributeZoneMap<T>>();
+        }
 
         AUTIL_LOG(INFO, "create output data for dir [%s]", attrDir->DebugString().c_str());
         return status;
@@ -396,6 +412,19 @@ void SingleValueAttributeMerger<T>::DestroyBuffers()
     _segOutputMapper.Clear();
 }
 
+template <typename T>
+Status SingleValueAttributeMerger<T>::DumpZoneMaps()
+{
+    for (auto& outputData : _segOutputMapper.GetOutputs()) {
+        if (outputData.zoneMap) {
+            assert(outputData.dataDir);
+            RETURN_IF_STATUS_ERROR(outputData.zoneMap->Store(outputData.dataDir), "store zone map to [%s] failed",
+                                   outputData.dataDir->DebugString().c_str());
+        }
+    }
+    return Status::OK();
+}
+
 template <typename T>
 void SingleValueAttributeMerger<T>::CloseFiles()
 {
@@ -19,5 +19,6 @@ namespace indexlib::index {
 inline const std::string INVERTED_INDEX_TYPE_STR = "inverted_index";
 inline const std::string INVERTED_INDEX_PATH = "index";
 inline const std::string OPTIMIZE_MERGE = "optimize_merge";
+inline const std::string MERGE_TERM_RANGE_COUNT = "merge_term_range_count";
 inline const std::string RANGE_INFO_FILE_NAME = "range_info";
 } // namespace indexlib::index
@@ -15,6 +15,9 @@
  */
 #include "indexlib/index/inverted_index/InvertedIndexMerger.h"
 
+#include <limits>
+
+#include "autil/ThreadPool.h"
 #include "indexlib/config/TabletSchema.h"
 #include "indexlib/file_system/file/CompressFileInfo.h"
 #include "indexlib/file_system/relocatable/RelocatableFolder.h"
@@ -55,6 +58,9 @@ using indexlibv2::framework::SegmentMeta;
 using indexlibv2::framework::SegmentStatistics;
 using indexlibv2::index::DocMapper;
 using indexlibv2::index::IIndexMerger;
+
+const std::string TERM_RANGE_DIR_PREFIX = "term_range_";
+const size_t TERM_RANGE_COPY_BUFFER_SIZE = 4 * 1024 * 1024; // 4M
 } // namespace
 
 AUTIL_LOG_SETUP(indexlib.index, InvertedIndexMerger);
@@ -82,6 +88,12 @@ Status InvertedIndexMerger::Init(const std::shared_ptr<IIndexConfig>& indexConfi
         !autil::StringUtil::fromString(std::any_cast<std::string>(iter->second), _isOptimizeMerge)) {
         _isOptimizeMerge = false;
     }
+    iter = params.find(MERGE_TERM_RANGE_COUNT);
+    if (iter == params.end() ||
+        !autil::StringUtil::fromString(std::any_cast<std::string>(iter->second), _termRangeCount) ||
+        _termRangeCount == 0) {
+        _termRangeCount = 1;
+    }
     _params = params;
     return Status::OK();
 }
@@ -155,19 +167,29 @@ Status InvertedIndexMerger::DoMerge(const SegmentMergeInfos& segMergeInfos,
         _termExtender->Init(segMergeInfos.targetSegments, _indexOutputSegmentResources);
     }
 
-    // Init term queue
     auto onDiskIndexIterCreator = CreateOnDiskIndexIteratorCreator();
-    SegmentTermInfoQueue termInfoQueue(_indexConfig, onDiskIndexIterCreator);
-    status = termInfoQueue.Init(segMergeInfos.srcSegments, _patchInfos);
-    RETURN_IF_STATUS_ERROR(status, "init term info queue for index [%s] failed", _indexConfig->GetIndexName().c_str());
+    std::vector<TermRange> termRanges;
+    if (_termRangeCount > 1 && CanMergeByTermRange(segMergeInfos)) {
+        termRanges = SplitTermRanges(segMergeInfos.srcSegments, _termRangeCount);
+    }
+    if (termRanges.size() > 1) {
+        status = MergeByTermRanges(segMergeInfos, termRanges, onDiskIndexIterCreator, docMapper);
+        RETURN_IF_STATUS_ERROR(status, "merge index [%s] by term ranges failed", _indexName.c_str());
+    } else {
+        // Init term queue
+        SegmentTermInfoQueue termInfoQueue(_indexConfig, onDiskIndexIterCreator);
+        status = termInfoQueue.Init(segMergeInfos.srcSegments, _patchInfos);
+        RETURN_IF_STATUS_ERROR(status, "init term info queue for index [%s] failed",
+                               _indexConfig->GetIndexName().c_str());
 
-    DictKeyInfo key;
-    while (!termInfoQueue.Empty()) {
-        SegmentTermInfo::TermIndexMode termMode;
-        const auto& segTermInfos = termInfoQueue.CurrentTermInfos(key, termMode);
-        status = MergeTerm(key, segTermInfos, termMode, docMapper, segMergeInfos.targetSegments);
-        RETURN_IF_STATUS_ERROR(status, "merge term failed.");
-        termInfoQueue.MoveToNextTerm();
+        DictKeyInfo key;
+        while (!termInfoQueue.Empty()) {
+            SegmentTermInfo::TermIndexMode termMode;
+            const auto& segTermInfos = termInfoQueue.CurrentTermInfos(key, termMode);
+            status = MergeTerm(key, segTermInfos, termMode, docMapper, segMergeInfos.targetSegments);
+            RETURN_IF_STATUS_ERROR(status, "merge term failed.");
+            termInfoQueue.MoveToNextTerm();
+        }
     }
     if (_termExtender) {
         _termExtender->Destroy();
@@ -223,12 +245,224 @@ InvertedIndexMerger::MergeTermPosting(const SegmentTermInfos& segTermInfos, Segm
     if (mode == SegmentTermInfo::TM_BITMAP) {
         postingMerger.reset(CreateBitmapPostingMerger(targetSegments));
     } else {
-        postingMerger.reset(CreatePostingMerger(targetSegments));
+        postingMerger.reset(CreatePostingMerger(_postingWriterResource.get(), targetSegments));
     }
     postingMerger->Merge(segTermInfos, docMapper);
     return postingMerger;
 }
 
+bool InvertedIndexMerger::CanMergeByTermRange(const SegmentMergeInfos& segMergeInfos) const
+{
+    InvertedIndexType indexType = _indexConfig->GetInvertedIndexType();
+    if (indexType != it_text && indexType != it_pack && indexType != it_expack) {
+        return false;
+    }
+    // bitmap terms, truncate, adaptive bitmap and patches are only supported by serial merge
+    if (segMergeInfos.targetSegments.size() != 1 || _termExtender || _indexConfig->GetHighFreqVocabulary() ||
+        !_patchInfos.empty()) {
+        return false;
+    }
+    for (const auto& srcSegment : segMergeInfos.srcSegments) {
+        auto indexDirectory = GetIndexDirectory(srcSegment.segment->GetSegmentDirectory());
+        if (indexDirectory && indexDirectory->IsExist(DICTIONARY_FILE_NAME)) {
+            continue;
+        }
+        auto segmentSchema = srcSegment.segment->GetSegmentSchema();
+        if (segmentSchema && segmentSchema->GetIndexConfig(INVERTED_INDEX_TYPE_STR, _indexName) == nullptr) {
+            // default value index iterator can not be split by term range
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<InvertedIndexMerger::TermRange>
+InvertedIndexMerger::SplitTermRanges(const std::vector<SourceSegment>& srcSegments, size_t rangeCount) const
+{
+    std::vector<TermRange> termRanges;
+    size_t idx = 0;
+    for (size_t i = 1; i < srcSegments.size(); ++i) {
+        if (srcSegments[i].segment->GetSegmentInfo()->docCount >
+            srcSegments[idx].segment->GetSegmentInfo()->docCount) {
+            idx = i;
+        }
+    }
+    auto indexDirectory = GetIndexDirectory(srcSegments[idx].segment->GetSegmentDirectory());
+    if (!indexDirectory || !indexDirectory->IsExist(DICTIONARY_FILE_NAME)) {
+        return termRanges;
+    }
+    uint64_t postingLength = 0;
+    std::shared_ptr<file_system::CompressFileInfo> compressInfo =
+        indexDirectory->GetCompressFileInfo(POSTING_FILE_NAME);
+    if (compressInfo) {
+        postingLength = compressInfo->deCompressFileLen;
+    } else {
+        postingLength = indexDirectory->GetFileLength(POSTING_FILE_NAME);
+    }
+
+    // sample the dictionary of the biggest segment, posting offset of a term is the posting length of all terms
+    // before it, so each range gets about the same posting length to merge
+    std::unique_ptr<DictionaryReader> dictReaderPtr(DictionaryCreator::CreateDiskReader(_indexConfig));
+    auto status = dictReaderPtr->Open(indexDirectory, DICTIONARY_FILE_NAME, true);
+    THROW_IF_STATUS_ERROR(status);
+    std::shared_ptr<DictionaryIterator> dictIter = dictReaderPtr->CreateIterator();
+    std::vector<dictkey_t> beginKeys(1, 0);
+    DictKeyInfo key;
+    dictvalue_t value;
+    while (dictIter->HasNext() && beginKeys.size() < rangeCount) {
+        dictIter->Next(key, value);
+        int64_t offset = 0;
+        if (key.IsNull() || !ShortListOptimizeUtil::GetOffset(value, offset)) {
+            continue;
+        }
+        if ((uint64_t)offset >= postingLength * beginKeys.size() / rangeCount && key.GetKey() > beginKeys.back()) {
+            beginKeys.push_back(key.GetKey());
+        }
+    }
+    for (size_t i = 0; i < beginKeys.size(); ++i) {
+        TermRange termRange;
+        termRange.beginKey = beginKeys[i];
+        if (i + 1 < beginKeys.size()) {
+            termRange.endKey = beginKeys[i + 1] - 1;
+            termRange.containNullKey = false;
+        } else {
+            termRange.endKey = std::numeric_limits<dictkey_t>::max();
+            termRange.containNullKey = true;
+        }
+        termRanges.push_back(termRange);
+    }
+    return termRanges;
+}
+
+Status InvertedIndexMerger::MergeByTermRanges(const SegmentMergeInfos& segMergeInfos,
+                                              const std::vector<TermRange>& termRanges,
+                                              const std::shared_ptr<OnDiskIndexIteratorCreator>& onDiskIndexIterCreator,
+                                              const std::shared_ptr<DocMapper>& docMapper)
+{
+    assert(_indexOutputSegmentResources.size() == 1);
+    AUTIL_LOG(INFO, "merge index [%s] by [%lu] term ranges", _indexName.c_str(), termRanges.size());
+    auto mergeDir = GetIndexDirectory(segMergeInfos.targetSegments[0]->segmentDir);
+    assert(mergeDir);
+    file_system::RemoveOption removeOption = file_system::RemoveOption::MayNonExist();
+    std::vector<std::string> rangeDirNames;
+    std::vector<std::shared_ptr<file_system::Directory>> rangeDirs;
+    for (size_t i = 0; i < termRanges.size(); ++i) {
+        rangeDirNames.push_back(TERM_RANGE_DIR_PREFIX + autil::StringUtil::toString(i));
+        mergeDir->RemoveDirectory(rangeDirNames[i], removeOption);
+        rangeDirs.push_back(mergeDir->MakeDirectory(rangeDirNames[i]));
+    }
+
+    std::vector<Status> rangeStatus(termRanges.size());
+    autil::ThreadPool threadPool(termRanges.size(), autil::ThreadPool::DEFAULT_QUEUESIZE, /*stopIfException*/ true);
+    threadPool.start("TermRangeMerge");
+    for (size_t i = 0; i < termRanges.size(); ++i) {
+        threadPool.pushTask([&, i]() {
+            try {
+                rangeStatus[i] =
+                    MergeTermRange(segMergeInfos, termRanges[i], onDiskIndexIterCreator, docMapper, rangeDirs[i]);
+            } catch (const std::exception& e) {
+                AUTIL_LOG(ERROR, "merge index [%s] term range [%lu] failed, exception[%s]", _indexName.c_str(), i,
+                          e.what());
+                rangeStatus[i] = Status::IOError("merge term range failed");
+            }
+        });
+    }
+    threadPool.waitFinish();
+    threadPool.stop();
+
+    auto indexDataWriter = _indexOutputSegmentResources[0]->GetIndexDataWriter(SegmentTermInfo::TM_NORMAL);
+    for (size_t i = 0; i < termRanges.size(); ++i) {
+        RETURN_IF_STATUS_ERROR(rangeStatus[i], "merge term range [%lu] failed", i);
+        // ranges are sorted by key, so the final dictionary keeps key sequence
+        auto status = ConcatTermRangeOutput(rangeDirs[i], indexDataWriter);
+        RETURN_IF_STATUS_ERROR(status, "concat term range [%lu] failed", i);
+        mergeDir->RemoveDirectory(rangeDirNames[i], removeOption);
+    }
+    return Status::OK();
+}
+
+Status InvertedIndexMerger::MergeTermRange(const SegmentMergeInfos& segMergeInfos, const TermRange& termRange,
+                                           const std::shared_ptr<OnDiskIndexIteratorCreator>& onDiskIndexIterCreator,
+                                           const std::shared_ptr<DocMapper>& docMapper,
+                                           const std::shared_ptr<file_system::Directory>& rangeDir)
+{
+    // each range owns its pools, posting writer resource and output files
+    util::SimplePool simplePool;
+    util::MMapAllocator allocator;
+    autil::mem_pool::Pool byteSlicePool(&allocator, DEFAULT_CHUNK_SIZE * 1024 * 1024);
+    autil::mem_pool::RecyclePool bufferPool(&allocator, DEFAULT_CHUNK_SIZE * 1024 * 1024);
+    PostingWriterResource postingWriterResource(&simplePool, &byteSlicePool, &bufferPool,
+                                                _indexFormatOption.GetPostingFormatOption());
+    auto outputResource = std::make_shared<IndexOutputSegmentResource>();
+    // same statistics as the target segment, so range files get the same compress param as the final files
+    outputResource->Init(rangeDir, _indexConfig, _ioConfig, GetSegmentStatistics(segMergeInfos.targetSegments[0]),
+                         &simplePool, /*needCreateBitmapIndex*/ false);
+    std::vector<std::shared_ptr<IndexOutputSegmentResource>> outputResources {outputResource};
+
+    SegmentTermInfoQueue termInfoQueue(_indexConfig, onDiskIndexIterCreator);
+    termInfoQueue.SetKeyRange(termRange.beginKey, termRange.endKey, termRange.containNullKey);
+    auto status = termInfoQueue.Init(segMergeInfos.srcSegments, _patchInfos);
+    RETURN_IF_STATUS_ERROR(status, "init term info queue for index [%s] failed", _indexName.c_str());
+
+    DictKeyInfo key;
+    while (!termInfoQueue.Empty()) {
+        SegmentTermInfo::TermIndexMode termMode;
+        const auto& segTermInfos = termInfoQueue.CurrentTermInfos(key, termMode);
+        assert(termMode == SegmentTermInfo::TM_NORMAL);
+        std::unique_ptr<PostingMerger> postingMerger(
+            CreatePostingMerger(&postingWriterResource, segMergeInfos.targetSegments));
+        postingMerger->Merge(segTermInfos, docMapper);
+        if (postingMerger->GetDocFreq() > 0) {
+            postingMerger->Dump(key, outputResources);
+        }
+        postingMerger.reset();
+        byteSlicePool.reset();
+        bufferPool.reset();
+        termInfoQueue.MoveToNextTerm();
+    }
+    outputResource->Reset();
+    return Status::OK();
+}
+
+Status InvertedIndexMerger::ConcatTermRangeOutput(const std::shared_ptr<file_system::Directory>& rangeDir,
+                                                  const std::shared_ptr<IndexDataWriter>& indexDataWriter)
+{
+    auto postingFile = indexDataWriter->postingWriter;
+    int64_t baseOffset = postingFile->GetLogicLength();
+
+    std::unique_ptr<DictionaryReader> dictReaderPtr(DictionaryCreator::CreateDiskReader(_indexConfig));
+    auto status = dictReaderPtr->Open(rangeDir, DICTIONARY_FILE_NAME, true);
+    RETURN_IF_STATUS_ERROR(status, "open dictionary in [%s] failed", rangeDir->DebugString().c_str());
+    std::shared_ptr<DictionaryIterator> dictIter = dictReaderPtr->CreateIterator();
+    DictKeyInfo key;
+    dictvalue_t value;
+    while (dictIter->HasNext()) {
+        dictIter->Next(key, value);
+        int64_t offset = 0;
+        if (ShortListOptimizeUtil::GetOffset(value, offset)) {
+            value = ShortListOptimizeUtil::CreateDictValue(ShortListOptimizeUtil::GetCompressMode(value),
+                                                           offset + baseOffset);
+        }
+        indexDataWriter->dictWriter->AddItem(key, value);
+    }
+
+    file_system::ReaderOption option(file_system::FSOT_BUFFERED);
+    option.supportCompress = true;
+    auto rangePostingFile = rangeDir->CreateFileReader(POSTING_FILE_NAME, option);
+    assert(rangePostingFile);
+    std::vector<char> buffer(TERM_RANGE_COPY_BUFFER_SIZE);
+    size_t fileLength = rangePostingFile->GetLogicLength();
+    for (size_t cursor = 0; cursor < fileLength;) {
+        size_t readLen = std::min(buffer.size(), fileLength - cursor);
+        auto [readStatus, actualLen] = rangePostingFile->Read(buffer.data(), readLen, cursor).StatusWith();
+        RETURN_IF_STATUS_ERROR(readStatus, "read posting in [%s] failed", rangeDir->DebugString().c_str());
+        assert(actualLen == readLen);
+        RETURN_IF_STATUS_ERROR(postingFile->Write(buffer.data(), actualLen).Status(), "write posting failed");
+        cursor += actualLen;
+    }
+    return rangePostingFile->Close().Status();
+}
+
 void InvertedIndexMerger::EndMerge()
 {
     for (auto& indexOutputSegmentResource : _indexOutputSegmentResources) {
@@ -325,20 +559,25 @@ void InvertedIndexMerger::PrepareIndexOutputSegmentResource(
         std::string optionString = IndexFormatOption::ToString(_indexFormatOption);
         mergeDir->Store(INDEX_FORMAT_OPTION_FILE_NAME, optionString);
         auto outputResource = std::make_shared<IndexOutputSegmentResource>(dictKeyCount);
-        auto segmentInfo = targetSegments[i]->segmentInfo;
-        assert(segmentInfo);
-        auto [status, segmentStatistics] = segmentInfo->GetSegmentStatistics();
-        auto segmentStatisticsPtr = std::make_shared<SegmentStatistics>(segmentStatistics);
-        if (!status.IsOK()) {
-            AUTIL_LOG(WARN, "segment statistics jsonize failed");
-            segmentStatisticsPtr = nullptr;
-        }
-        outputResource->Init(mergeDir, _indexConfig, _ioConfig, /*SegmentStatistics*/ segmentStatisticsPtr,
+        outputResource->Init(mergeDir, _indexConfig, _ioConfig, GetSegmentStatistics(targetSegments[i]),
                              &_simplePool, needCreateBitmapIndex);
         _indexOutputSegmentResources.push_back(outputResource);
     }
 }
 
+std::shared_ptr<SegmentStatistics>
+InvertedIndexMerger::GetSegmentStatistics(const std::shared_ptr<SegmentMeta>& targetSegment) const
+{
+    auto segmentInfo = targetSegment->segmentInfo;
+    assert(segmentInfo);
+    auto [status, segmentStatistics] = segmentInfo->GetSegmentStatistics();
+    if (!status.IsOK()) {
+        AUTIL_LOG(WARN, "segment statistics jsonize failed");
+        return nullptr;
+    }
+    return std::make_shared<SegmentStatistics>(segmentStatistics);
+}
+
 std::pair<Status, int64_t>
 InvertedIndexMerger::GetMaxLengthOfPosting(std::shared_ptr<file_system::Directory> indexDirectory,
                                            const SegmentInfo& segInfo) const
@@ -452,9 +691,10 @@ InvertedIndexMerger::CreateBitmapPostingMerger(const std::vector<std::shared_ptr
     return bitmapPostingMerger;
 }
 
-PostingMerger* InvertedIndexMerger::CreatePostingMerger(const std::vector<std::shared_ptr<SegmentMeta>>& targetSegments)
+PostingMerger* InvertedIndexMerger::CreatePostingMerger(PostingWriterResource* postingWriterResource,
+                                                       const std::vector<std::shared_ptr<SegmentMeta>>& targetSegments)
 {
-    PostingMergerImpl* postingMergerImpl = new PostingMergerImpl(_postingWriterResource.get(), targetSegments);
+    PostingMergerImpl* postingMergerImpl = new PostingMergerImpl(postingWriterResource, targetSegments);
     return postingMergerImpl;
 }
 
@@ -39,6 +39,7 @@ class RelocatableFolder;
 namespace indexlibv2::framework {
 class SegmentInfo;
 struct SegmentMeta;
+class SegmentStatistics;
 class IndexTaskResourceManager;
 } // namespace indexlibv2::framework
 
@@ -67,6 +68,7 @@ class IndexTermExtender;
 class OnDiskIndexIteratorCreator;
 class PostingMerger;
 class MultiAdaptiveBitmapIndexWriter;
+struct IndexDataWriter;
 struct PostingWriterResource;
 
 class InvertedIndexMerger : public indexlibv2::index::IIndexMerger
@@ -86,7 +88,8 @@ public:
 protected:
     virtual std::shared_ptr<OnDiskIndexIteratorCreator> CreateOnDiskIndexIteratorCreator() = 0;
     virtual PostingMerger*
-    CreatePostingMerger(const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
+    CreatePostingMerger(PostingWriterResource* postingWriterResource,
+                        const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
     virtual PostingMerger*
     CreateBitmapPostingMerger(const std::vector<std::shared_ptr<indexlibv2::framework::SegmentMeta>>& targetSegments);
     virtual void PrepareIndexOutputSegmentResource(
@@ -112,9 +115,30 @@ protected:
     util::SimplePool _simplePool;
     std::vector<std::shared_ptr<IndexOutputSegmentResource>> _indexOutputSegmentResources;
 
+private:
+    // terms with key in [beginKey, endKey] are merged by one thread
+    struct TermRange {
+        dictkey_t beginKey = 0;
+        dictkey_t endKey = 0;
+        bool containNullKey = false;
+    };
+
 private:
     bool NeedPreloadMaxDictCount(size_t targetSegmentCount) const;
+    bool CanMergeByTermRange(const SegmentMergeInfos& segMergeInfos) const;
+    std::vector<TermRange> SplitTermRanges(const std::vector<SourceSegment>& srcSegments, size_t rangeCount) const;
+    Status MergeByTermRanges(const SegmentMergeInfos& segMergeInfos, const std::vector<TermRange>& termRanges,
+                             const std::shared_ptr<OnDiskIndexIteratorCreator>& onDiskIndexIterCreator,
+                             const std::shared_ptr<indexlibv2::index::DocMapper>& docMapper);
+    Status MergeTermRange(const SegmentMergeInfos& segMergeInfos, const TermRange& termRange,
+                          const std::shared_ptr<OnDiskIndexIteratorCreator>& onDiskIndexIterCreator,
+                          const std::shared_ptr<indexlibv2::index::DocMapper>& docMapper,
+                          const std::shared_ptr<file_system::Directory>& rangeDir);
+    Status ConcatTermRangeOutput(const std::shared_ptr<file_system::Directory>& rangeDir,
+                                 const std::shared_ptr<IndexDataWriter>& indexDataWriter);
     size_t GetDictKeyCount(const std::vector<SourceSegment>& srcSegments) const;
+    std::shared_ptr<indexlibv2::framework::SegmentStatistics>
+    GetSegmentStatistics(const std::shared_ptr<indexlibv2::framework::SegmentMeta>& targetSegment) const;
     void EndMerge();
     Status MergePatches(const SegmentMergeInfos& segmentMergeInfos);
     Status MergeTerm(DictKeyInfo key, const SegmentTermInfos& segTermInfos, SegmentTermInfo::TermIndexMode mode,
@@ -154,6 +178,7 @@ private:
     indexlibv2::index::PatchInfos _patchInfos;
 
     bool _isOptimizeMerge = false;
+    uint32_t _termRangeCount = 1;
 
     std::map<std::string, std::any> _params;
     std::map<std::string, std::shared_ptr<BucketMap>> _bucketMaps;
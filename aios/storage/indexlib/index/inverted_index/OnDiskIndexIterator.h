@@ -40,6 +40,9 @@ public:
 public:
     virtual void Init() = 0;
     virtual size_t GetPostingFileLength() const = 0;
+    // only iterate terms with key in [beginKey, endKey], null term only if containNullKey.
+    // should be called after Init, return false if not supported.
+    virtual bool SetKeyRange(dictkey_t beginKey, dictkey_t endKey, bool containNullKey) { return false; }
 
 protected:
     file_system::DirectoryPtr _indexDirectory;
@@ -24,6 +24,7 @@
 #include "indexlib/index/inverted_index/patch/InvertedIndexPatchFileFinder.h"
 #include "indexlib/index/inverted_index/patch/SingleFieldIndexSegmentPatchIterator.h"
 #include "indexlib/index/inverted_index/patch/SingleTermIndexSegmentPatchIterator.h"
+#include "indexlib/util/Exception.h"
 
 namespace indexlib::index {
 namespace {
@@ -51,6 +52,15 @@ SegmentTermInfoQueue::~SegmentTermInfoQueue()
     }
 }
 
+void SegmentTermInfoQueue::SetKeyRange(dictkey_t beginKey, dictkey_t endKey, bool containNullKey)
+{
+    assert(_segmentTermInfos.empty());
+    _hasKeyRange = true;
+    _beginKey = beginKey;
+    _endKey = endKey;
+    _containNullKey = containNullKey;
+}
+
 Status SegmentTermInfoQueue::Init(const std::vector<IIndexMerger::SourceSegment>& srcSegments,
                                   const indexlibv2::index::PatchInfos& patchInfos)
 {
@@ -195,6 +205,10 @@ SegmentTermInfoQueue::CreateOnDiskNormalIterator(const std::shared_ptr<file_syst
     if (onDiskIndexIter) {
         indexIt.reset(onDiskIndexIter);
         onDiskIndexIter->Init();
+        if (_hasKeyRange && !onDiskIndexIter->SetKeyRange(_beginKey, _endKey, _containNullKey)) {
+            INDEXLIB_FATAL_ERROR(UnSupported, "index [%s] not support merge by key range",
+                                 _indexConfig->GetIndexName().c_str());
+        }
     }
     return indexIt;
 }
@@ -215,6 +229,10 @@ SegmentTermInfoQueue::CreateOnDiskBitmapIterator(const std::shared_ptr<file_syst
         OnDiskIndexIterator* onDiskIndexIter = _onDiskIndexIterCreator->CreateBitmapIterator(indexDir);
         indexIt.reset(onDiskIndexIter);
         onDiskIndexIter->Init();
+        if (_hasKeyRange && !onDiskIndexIter->SetKeyRange(_beginKey, _endKey, _containNullKey)) {
+            INDEXLIB_FATAL_ERROR(UnSupported, "index [%s] not support merge by key range",
+                                 _indexConfig->GetIndexName().c_str());
+        }
     }
     return indexIt;
 }
@@ -41,6 +41,8 @@ public:
                 const indexlibv2::index::PatchInfos& patchInfos);
     Status Init(const std::shared_ptr<file_system::Directory>& indexDir,
                 const std::shared_ptr<indexlibv2::index::PatchFileInfo>& patchFileInfo);
+    // only merge terms with key in [beginKey, endKey], should be called before Init
+    void SetKeyRange(dictkey_t beginKey, dictkey_t endKey, bool containNullKey);
     inline bool Empty() const { return _segmentTermInfos.empty(); }
 
     const std::vector<SegmentTermInfo*>& CurrentTermInfos(index::DictKeyInfo& key,
@@ -84,6 +86,10 @@ private:
     std::map<segmentid_t, indexlibv2::index::PatchFileInfos> _patchInfos;
     std::shared_ptr<indexlibv2::config::InvertedIndexConfig> _indexConfig;
     std::shared_ptr<OnDiskIndexIteratorCreator> _onDiskIndexIterCreator;
+    bool _hasKeyRange = false;
+    bool _containNullKey = true;
+    dictkey_t _beginKey = 0;
+    dictkey_t _endKey = 0;
 
     AUTIL_LOG_DECLARE();
 };
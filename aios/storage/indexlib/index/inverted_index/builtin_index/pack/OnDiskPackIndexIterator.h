@@ -26,6 +26,7 @@
 #include "indexlib/index/inverted_index/format/PostingDecoderImpl.h"
 #include "indexlib/index/inverted_index/format/ShortListOptimizeUtil.h"
 #include "indexlib/index/inverted_index/format/TermMetaLoader.h"
+#include "indexlib/index/inverted_index/format/dictionary/CommonDiskTieredDictionaryIterator.h"
 #include "indexlib/index/inverted_index/format/dictionary/DictionaryCreator.h"
 #include "indexlib/util/Bitmap.h"
 #include "indexlib/util/PathUtil.h"
@@ -97,6 +98,7 @@ public:
 
     PostingDecoder* Next(index::DictKeyInfo& key) override;
     size_t GetPostingFileLength() const override { return _postingFile ? _postingFile->GetLogicLength() : 0; }
+    bool SetKeyRange(dictkey_t beginKey, dictkey_t endKey, bool containNullKey) override;
 
 private:
     virtual void CreatePostingDecoder() { _decoder.reset(new PostingDecoderImpl(this->_postingFormatOption)); }
@@ -109,6 +111,7 @@ private:
 
     void InitDecoderForDictInlinePosting(dictvalue_t value, bool isDocList, bool dfFirst);
     void InitDecoderForNormalPosting(dictvalue_t value);
+    void MoveToKeyRange();
 
 protected:
     std::shared_ptr<indexlibv2::config::InvertedIndexConfig> _indexConfig;
@@ -125,6 +128,15 @@ protected:
     TermMeta* _termMeta = nullptr;
     std::shared_ptr<PostingDecoderImpl> _decoder;
 
+    // dictionary item read ahead to skip keys out of range without decoding postings
+    bool _hasKeyRange = false;
+    bool _hasRangeItem = false;
+    bool _containNullKey = false;
+    dictkey_t _beginKey = 0;
+    dictkey_t _endKey = 0;
+    index::DictKeyInfo _rangeKey;
+    dictvalue_t _rangeValue = 0;
+
 private:
     AUTIL_LOG_DECLARE();
 };
@@ -193,14 +205,66 @@ void OnDiskPackIndexIteratorTyped<DictKey>::Init()
 template <typename DictKey>
 bool OnDiskPackIndexIteratorTyped<DictKey>::HasNext() const
 {
+    if (_hasKeyRange) {
+        return _hasRangeItem;
+    }
     return _dictionaryIterator->HasNext();
 }
 
+template <typename DictKey>
+bool OnDiskPackIndexIteratorTyped<DictKey>::SetKeyRange(dictkey_t beginKey, dictkey_t endKey, bool containNullKey)
+{
+    assert(_dictionaryIterator);
+    _hasKeyRange = true;
+    _beginKey = beginKey;
+    _endKey = endKey;
+    _containNullKey = containNullKey;
+    // tiered dictionary is sorted by key, skip keys before range by block index.
+    // hash dictionary can only be scanned
+    auto tieredIterator =
+        std::dynamic_pointer_cast<CommonDiskTieredDictionaryIteratorTyped<DictKey>>(_dictionaryIterator);
+    if (tieredIterator && _beginKey > 0) {
+        tieredIterator->SkipTo(_beginKey);
+    }
+    MoveToKeyRange();
+    if (!HasNext()) {
+        _postingFile->Close().GetOrThrow();
+    }
+    return true;
+}
+
+template <typename DictKey>
+void OnDiskPackIndexIteratorTyped<DictKey>::MoveToKeyRange()
+{
+    _hasRangeItem = false;
+    while (_dictionaryIterator->HasNext()) {
+        _dictionaryIterator->Next(_rangeKey, _rangeValue);
+        if (_rangeKey.IsNull()) {
+            // null term is the last one in dictionary
+            _hasRangeItem = _containNullKey;
+            return;
+        }
+        if (_rangeKey.GetKey() < _beginKey) {
+            continue;
+        }
+        // keys are sorted in dictionary, no need to read on after endKey
+        _hasRangeItem = (_rangeKey.GetKey() <= _endKey);
+        return;
+    }
+}
+
 template <typename DictKey>
 PostingDecoder* OnDiskPackIndexIteratorTyped<DictKey>::Next(index::DictKeyInfo& key)
 {
     dictvalue_t value;
-    _dictionaryIterator->Next(key, value);
+    if (_hasKeyRange) {
+        assert(_hasRangeItem);
+        key = _rangeKey;
+        value = _rangeValue;
+        MoveToKeyRange();
+    } else {
+        _dictionaryIterator->Next(key, value);
+    }
     bool isDocList = false;
     bool dfFirst = true;
     if (ShortListOptimizeUtil::IsDictInlineCompressMode(value, isDocList, dfFirst)) {
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "indexlib/file_system/file/FileReader.h"
 #include "indexlib/file_system/stream/FileStream.h"
@@ -48,6 +49,9 @@ public:
     bool HasNext() const override;
     void Next(index::DictKeyInfo& key, dictvalue_t& value) override;
     void Seek(dictkey_t key) override;
+    // move to the first key not less than @key, the null term (sorted after all keys) is kept.
+    // block index is loaded from file when the iterator is created without one
+    void SkipTo(dictkey_t key);
 
     future_lite::coro::Lazy<index::ErrorCode> SeekAsync(dictkey_t key,
                                                         file_system::ReadOption option) noexcept override;
@@ -61,6 +65,7 @@ private:
     dictvalue_t _nullTermValue;
     KeyType* _blockIndex;
     uint32_t _blockCount;
+    std::vector<KeyType> _loadedBlockIndex;
     bool _hasNullTerm;
     bool _isDone;
 
@@ -177,6 +182,30 @@ void CommonDiskTieredDictionaryIteratorTyped<KeyType>::Seek(dictkey_t key)
     return;
 }
 
+template <typename KeyType>
+void CommonDiskTieredDictionaryIteratorTyped<KeyType>::SkipTo(dictkey_t key)
+{
+    if (!_blockIndex) {
+        // block index is stored right after dictionary data
+        _loadedBlockIndex.resize(_blockCount);
+        size_t readLength = _blockCount * sizeof(KeyType);
+        size_t readed =
+            _fileStream->Read(_loadedBlockIndex.data(), readLength, _dictDataLength, file_system::ReadOption())
+                .GetOrThrow();
+        if (readed != readLength) {
+            INDEXLIB_FATAL_ERROR(FileIO, "read block index from [%s] fail, offset[%zu], len[%zu], readed[%zu]",
+                                 _fileStream->DebugString().c_str(), _dictDataLength, readLength, readed);
+        }
+        _blockIndex = _loadedBlockIndex.data();
+    }
+    if (_blockCount == 0 || _blockIndex[_blockCount - 1] < key) {
+        _offset = _dictDataLength;
+        _isDone = !_hasNullTerm;
+        return;
+    }
+    Seek(key);
+}
+
 template <typename KeyType>
 inline future_lite::coro::Lazy<index::ErrorCode>
 CommonDiskTieredDictionaryIteratorTyped<KeyType>::SeekAsync(dictkey_t key, file_system::ReadOption option) noexcept
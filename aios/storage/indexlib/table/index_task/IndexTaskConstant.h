@@ -29,6 +29,7 @@ static constexpr const char* RESERVED_VERSION_SET = "reserved_version_set";
 static constexpr const char* RESERVED_VERSION_COORD_SET = "reserved_version_coord_set";
 static constexpr const char* PARAM_TARGET_VERSION = "target_version";
 static constexpr const char* SEGMENT_METRICS_TMP_PATH = "segment_metrics_tmp_path";
+static constexpr const char* SEGMENT_READ_COST = "segment_read_cost";
 static constexpr const char* DEPENDENT_OPERATION_ID = "dependent_operation_id";
 static constexpr const char* SHARD_INDEX_NAME = "multi_shard_inverted_index";
 static constexpr const char* TASK_NAME = "task_name";
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "indexlib/table/index_task/merger/ReadCostMergeStrategy.h"
+
+#include <algorithm>
+
+#include "autil/StringUtil.h"
+#include "indexlib/table/index_task/IndexTaskConstant.h"
+
+namespace indexlibv2::table {
+AUTIL_LOG_SETUP(indexlib.table, ReadCostMergeStrategy);
+
+Status ReadCostMergeStrategy::AdjustMergeTag(const framework::IndexTaskContext* context,
+                                             const std::shared_ptr<indexlibv2::framework::LevelInfo>& levelInfo,
+                                             std::vector<std::vector<bool>>& mergeTag)
+{
+    auto [status, segmentReadCost] = ParseSegmentReadCost(context);
+    RETURN_IF_STATUS_ERROR(status, "parse segment read cost failed");
+    std::vector<std::vector<size_t>> segmentsSize;
+    std::vector<size_t> levelsSize;
+    status = GetLevelSizeInfo(levelInfo, context->GetTabletData(), segmentsSize, levelsSize);
+    RETURN_IF_STATUS_ERROR(status, "get level size info failed");
+
+    size_t levelNum = levelInfo->GetLevelCount();
+    size_t shardCount = levelInfo->GetShardCount();
+    size_t lastMergeLevel = _disableLastLevelMerge ? levelNum - 2 : levelNum - 1;
+    // level 0 is not a candidate: it has no merge tag and is always merged into level 1 of every shard, so its
+    // share is counted in the rewrite size of level 1
+    bool hasLevel0Segment = false;
+    for (auto segmentId : levelInfo->levelMetas[0].segments) {
+        hasLevel0Segment = hasLevel0Segment || (segmentId != INVALID_SEGMENTID);
+    }
+    size_t level0ShardSize = hasLevel0Segment ? levelsSize[0] / shardCount : 0;
+    auto getRewriteSize = [&](size_t levelIdx, size_t shardIdx) {
+        size_t baseSize = GetShardRewriteSize(mergeTag, segmentsSize, hasLevel0Segment, level0ShardSize, shardIdx);
+        mergeTag[levelIdx][shardIdx] = true;
+        size_t taggedSize = GetShardRewriteSize(mergeTag, segmentsSize, hasLevel0Segment, level0ShardSize, shardIdx);
+        mergeTag[levelIdx][shardIdx] = false;
+        return taggedSize - baseSize;
+    };
+
+    std::vector<MergeCandidate> candidates;
+    for (size_t levelIdx = 1; levelIdx < lastMergeLevel; ++levelIdx) {
+        for (size_t shardIdx = 0; shardIdx < shardCount; ++shardIdx) {
+            segmentid_t segmentId = levelInfo->levelMetas[levelIdx].segments[shardIdx];
+            if (segmentId == INVALID_SEGMENTID || mergeTag[levelIdx][shardIdx]) {
+                continue;
+            }
+            MergeCandidate candidate;
+            candidate.levelIdx = levelIdx;
+            candidate.shardIdx = shardIdx;
+            candidate.rewriteSize = getRewriteSize(levelIdx, shardIdx);
+            auto iter = segmentReadCost.find(segmentId);
+            double readCost = (iter != segmentReadCost.end()) ? iter->second : _defaultReadCost;
+            candidate.readCostPerGB = readCost * 1024 * 1024 * 1024 / std::max(candidate.rewriteSize, (size_t)1);
+            if (candidate.readCostPerGB > _minReadCostPerGB) {
+                candidates.push_back(candidate);
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const MergeCandidate& lhs, const MergeCandidate& rhs) {
+        return lhs.readCostPerGB > rhs.readCostPerGB;
+    });
+
+    uint64_t leftBudget = _writeBudget;
+    for (const auto& candidate : candidates) {
+        // tags taken before may chain with this one, the rewrite size is computed again with them
+        size_t rewriteSize = getRewriteSize(candidate.levelIdx, candidate.shardIdx);
+        if (rewriteSize > leftBudget) {
+            continue;
+        }
+        leftBudget -= rewriteSize;
+        mergeTag[candidate.levelIdx][candidate.shardIdx] = true;
+        AUTIL_LOG(INFO, "merge level [%lu] shard [%lu] for read cost, rewrite size [%lu], read cost per GB [%lf]",
+                  candidate.levelIdx, candidate.shardIdx, rewriteSize, candidate.readCostPerGB);
+    }
+    AUTIL_LOG(INFO, "[%lu] merge candidates, write budget used [%lu]", candidates.size(), _writeBudget - leftBudget);
+    return Status::OK();
+}
+
+size_t ReadCostMergeStrategy::GetShardRewriteSize(const std::vector<std::vector<bool>>& mergeTag,
+                                                  const std::vector<std::vector<size_t>>& segmentsSize,
+                                                  bool hasLevel0Segment, size_t level0ShardSize, size_t shardIdx)
+{
+    // same chains as DoCreateMergePlan: a chain starts at a tagged level (or at level 1 when level 0 has
+    // segments), goes through tagged levels and ends at the first untagged level, every segment in it is rewritten
+    size_t rewriteSize = 0;
+    bool inChain = hasLevel0Segment;
+    size_t chainSize = level0ShardSize;
+    for (size_t levelIdx = 1; levelIdx < mergeTag.size(); ++levelIdx) {
+        bool tagged = mergeTag[levelIdx][shardIdx];
+        if (!inChain && !tagged) {
+            continue;
+        }
+        chainSize += segmentsSize[levelIdx][shardIdx];
+        inChain = tagged;
+        if (!tagged) {
+            rewriteSize += chainSize;
+            chainSize = 0;
+        }
+    }
+    return rewriteSize;
+}
+
+std::pair<Status, std::map<segmentid_t, double>>
+ReadCostMergeStrategy::ParseSegmentReadCost(const framework::IndexTaskContext* context)
+{
+    std::map<segmentid_t, double> segmentReadCost;
+    std::string readCostStr;
+    if (!context->GetParameter(SEGMENT_READ_COST, readCostStr) || readCostStr.empty()) {
+        AUTIL_LOG(INFO, "no segment read cost, use default read cost for all segments");
+        return {Status::OK(), segmentReadCost};
+    }
+    std::vector<std::vector<std::string>> items;
+    autil::StringUtil::fromString(readCostStr, items, ":", ";");
+    for (const auto& item : items) {
+        segmentid_t segmentId = INVALID_SEGMENTID;
+        double readCost = 0;
+        if (item.size() != 2 || !autil::StringUtil::fromString(item[0], segmentId) ||
+            !autil::StringUtil::fromString(item[1], readCost) || readCost < 0) {
+            AUTIL_LOG(ERROR, "invalid segment read cost [%s]", readCostStr.c_str());
+            return {Status::InvalidArgs("invalid segment read cost"), segmentReadCost};
+        }
+        segmentReadCost[segmentId] = readCost;
+    }
+    return {Status::OK(), segmentReadCost};
+}
+
+void ReadCostMergeStrategy::SetParameter(const config::MergeStrategyParameter& param)
+{
+    ShardBasedMergeStrategy::SetParameter(param);
+
+    std::vector<std::string> configItems;
+    autil::StringUtil::fromString(param.GetStrategyConditions(), configItems, ";");
+    for (const auto& item : configItems) {
+        std::vector<std::string> kvPairs = autil::StringUtil::split(item, '=');
+        if (kvPairs.size() != 2) {
+            continue;
+        }
+        const auto& k = kvPairs[0];
+        const auto& v = kvPairs[1];
+        if (k == "write_budget_mb") {
+            uint64_t value = 0;
+            if (autil::StringUtil::fromString(v, value)) {
+                _writeBudget = value * 1024 * 1024;
+            }
+        } else if (k == "default_read_cost") {
+            double value = 0.0;
+            if (autil::StringUtil::fromString(v, value) && value >= 0) {
+                _defaultReadCost = value;
+            }
+        } else if (k == "min_read_cost_per_gb") {
+            double value = 0.0;
+            if (autil::StringUtil::fromString(v, value)) {
+                _minReadCostPerGB = value;
+            }
+        }
+    }
+
+    AUTIL_LOG(INFO, "write budget [%lu], default read cost [%lf], min read cost per GB [%lf]", _writeBudget,
+              _defaultReadCost, _minReadCostPerGB);
+}
+
+} // namespace indexlibv2::table
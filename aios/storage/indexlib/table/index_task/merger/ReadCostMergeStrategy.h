@@ -0,0 +1,74 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "autil/Log.h"
+#include "indexlib/table/index_task/merger/ShardBasedMergeStrategy.h"
+
+namespace indexlibv2 { namespace table {
+
+// shard based merge strategy which also spends a write budget on merges that save the most query read cost.
+// read cost of a segment is the expected cost one query pays on it (probes per query * cost per probe, e.g.
+// segment hops or posting decode time collected from reader metrics), passed in by task parameter
+// SEGMENT_READ_COST as "segmentId:cost;segmentId:cost". segments without statistics use default_read_cost.
+// pushing a segment of level k into level k+1 saves its read cost and rewrites both segments, plus every level the
+// merge cascades through with other merge tags. candidates are taken by saved read cost per byte rewritten until
+// write_budget_mb is used up.
+class ReadCostMergeStrategy : public ShardBasedMergeStrategy
+{
+public:
+    ReadCostMergeStrategy() = default;
+    ~ReadCostMergeStrategy() = default;
+
+public:
+    std::string GetName() const override { return MergeStrategyDefine::READ_COST_MERGE_STRATEGY_NAME; }
+
+protected:
+    void SetParameter(const config::MergeStrategyParameter& param) override;
+    Status AdjustMergeTag(const framework::IndexTaskContext* context,
+                          const std::shared_ptr<indexlibv2::framework::LevelInfo>& levelInfo,
+                          std::vector<std::vector<bool>>& mergeTag) override;
+
+private:
+    struct MergeCandidate {
+        size_t levelIdx = 0;
+        size_t shardIdx = 0;
+        size_t rewriteSize = 0;
+        double readCostPerGB = 0;
+    };
+
+private:
+    static std::pair<Status, std::map<segmentid_t, double>>
+    ParseSegmentReadCost(const framework::IndexTaskContext* context);
+    static size_t GetShardRewriteSize(const std::vector<std::vector<bool>>& mergeTag,
+                                      const std::vector<std::vector<size_t>>& segmentsSize, bool hasLevel0Segment,
+                                      size_t level0ShardSize, size_t shardIdx);
+
+private:
+    uint64_t _writeBudget = 1024 * 1024 * 1024; // 1G
+    double _defaultReadCost = 1.0;
+    double _minReadCostPerGB = 0;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+}} // namespace indexlibv2::table
@@ -66,6 +66,10 @@ ShardBasedMergeStrategy::CreateMergePlan(const framework::IndexTaskContext* cont
     if (!status.IsOK()) {
         return std::make_pair(status, nullptr);
     }
+    status = AdjustMergeTag(context, levelInfo, mergeTag);
+    if (!status.IsOK()) {
+        return std::make_pair(status, nullptr);
+    }
     return DoCreateMergePlan(context, mergeTag);
 }
 
@@ -35,18 +35,27 @@ class ShardBasedMergeStrategy : public MergeStrategy
 {
 public:
     ShardBasedMergeStrategy() = default;
-    ~ShardBasedMergeStrategy() = default;
+    virtual ~ShardBasedMergeStrategy() = default;
 
 public:
     std::string GetName() const override { return MergeStrategyDefine::SHARD_BASED_MERGE_STRATEGY_NAME; }
     std::pair<Status, std::shared_ptr<MergePlan>> CreateMergePlan(const framework::IndexTaskContext* context) override;
 
-private:
-    void SetParameter(const config::MergeStrategyParameter& param);
-    void GetLevelThreshold(uint32_t levelNum, size_t bottomLevelSize, std::vector<size_t>& levelsThreshold);
+protected:
+    virtual void SetParameter(const config::MergeStrategyParameter& param);
+    // mergeTag[level][shard] is true if the segment is merged into the next level
+    virtual Status AdjustMergeTag(const framework::IndexTaskContext* context,
+                                  const std::shared_ptr<indexlibv2::framework::LevelInfo>& levelInfo,
+                                  std::vector<std::vector<bool>>& mergeTag)
+    {
+        return Status::OK();
+    }
     Status GetLevelSizeInfo(const std::shared_ptr<indexlibv2::framework::LevelInfo>& levelInfo,
                             const std::shared_ptr<framework::TabletData>& tabletData,
                             std::vector<std::vector<size_t>>& segmentsSize, std::vector<size_t>& actualLevelSize);
+
+private:
+    void GetLevelThreshold(uint32_t levelNum, size_t bottomLevelSize, std::vector<size_t>& levelsThreshold);
     std::pair<Status, std::shared_ptr<MergePlan>> DoCreateMergePlan(const framework::IndexTaskContext* context,
                                                                     const std::vector<std::vector<bool>>& mergeTag);
     void CollectSegmentDescriptions(const std::shared_ptr<indexlibv2::framework::LevelInfo>& originalLevelInfo,
@@ -70,7 +79,7 @@ public:
         SetParameter(param);
     }
 
-private:
+protected:
     double _spaceAmplification = 1.5;
     bool _disableLastLevelMerge = false;
 
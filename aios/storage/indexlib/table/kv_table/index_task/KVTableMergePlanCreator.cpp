@@ -36,6 +36,7 @@
 #include "indexlib/table/index_task/IndexTaskConstant.h"
 #include "indexlib/table/index_task/merger/MergeStrategy.h"
 #include "indexlib/table/index_task/merger/MergeStrategyDefine.h"
+#include "indexlib/table/index_task/merger/ReadCostMergeStrategy.h"
 #include "indexlib/table/index_task/merger/ShardBasedMergeStrategy.h"
 #include "indexlib/table/kv_table/index_task/KVTableMergeDescriptionCreator.h"
 #include "indexlib/table/kv_table/index_task/KeyValueOptimizeMergeStrategy.h"
@@ -146,6 +147,9 @@ KVTableMergePlanCreator::CreateMergeStrategy(const framework::IndexTaskContext*
     if (mergeConfig.GetMergeStrategyStr() == MergeStrategyDefine::SHARD_BASED_MERGE_STRATEGY_NAME) {
         return std::make_unique<ShardBasedMergeStrategy>();
     }
+    if (mergeConfig.GetMergeStrategyStr() == MergeStrategyDefine::READ_COST_MERGE_STRATEGY_NAME) {
+        return std::make_unique<ReadCostMergeStrategy>();
+    }
     AUTIL_LOG(ERROR, "not support merge strategy name [%s]", mergeConfig.GetMergeStrategyStr().c_str());
     return nullptr;
 }
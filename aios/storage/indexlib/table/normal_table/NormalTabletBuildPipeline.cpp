@@ -0,0 +1,137 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "indexlib/table/normal_table/NormalTabletBuildPipeline.h"
+
+#include <unistd.h>
+
+#include "autil/ThreadPool.h"
+#include "autil/legacy/exception.h"
+#include "indexlib/document/IDocumentBatch.h"
+#include "indexlib/index/common/BuildWorkItem.h"
+
+namespace indexlib::table {
+AUTIL_LOG_SETUP(indexlib.table, NormalTabletBuildPipeline);
+
+NormalTabletBuildPipeline::NormalTabletBuildPipeline(const std::shared_ptr<autil::ThreadPool>& threadPool,
+                                                     size_t maxPendingBatchCount)
+    : _threadPool(threadPool)
+    , _maxPendingBatchCount(maxPendingBatchCount)
+    , _unfinishedBatchCount(0)
+{
+}
+
+NormalTabletBuildPipeline::~NormalTabletBuildPipeline() { WaitFinish(); }
+
+void NormalTabletBuildPipeline::AddStage(const std::string& name, WorkItemCreator&& creator)
+{
+    _stages.emplace_back(std::make_unique<Stage>(name, std::move(creator), _maxPendingBatchCount));
+}
+
+void NormalTabletBuildPipeline::Push(const std::shared_ptr<indexlibv2::document::IDocumentBatch>& batch,
+                                     std::function<void()>&& onFinish)
+{
+    auto context = std::make_shared<BatchContext>();
+    context->batch = batch;
+    context->unfinishedStageCount.store(_stages.size(), std::memory_order_relaxed);
+    context->onFinish = std::move(onFinish);
+    {
+        std::lock_guard<std::mutex> lock(_finishMutex);
+        ++_unfinishedBatchCount;
+    }
+    if (_stages.empty()) {
+        context->unfinishedStageCount.store(1, std::memory_order_relaxed);
+        FinishStage(context);
+        return;
+    }
+    for (const auto& stage : _stages) {
+        bool logged = false;
+        while (!stage->queue.TryPush(context)) {
+            if (!logged) {
+                AUTIL_LOG(DEBUG, "stage [%s] has [%lu] batches to build, wait", stage->name.c_str(),
+                          stage->queue.Size());
+                logged = true;
+            }
+            usleep(STAGE_FULL_SLEEP_US);
+        }
+        // pairs with the fence in BuildOneBatch: either the consumer sees this batch or we see it unscheduled
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        Schedule(stage.get());
+    }
+}
+
+void NormalTabletBuildPipeline::Schedule(Stage* stage)
+{
+    if (stage->scheduled.exchange(true)) {
+        return;
+    }
+    auto ret = _threadPool->pushTask([this, stage]() { BuildOneBatch(stage); });
+    if (ret != autil::ThreadPool::ERROR_NONE) {
+        // queued batches must still be built or WaitFinish never returns, build them in the caller thread, which
+        // also clears scheduled
+        AUTIL_LOG(ERROR, "push stage [%s] to build thread pool failed, error [%d], build in caller thread",
+                  stage->name.c_str(), (int)ret);
+        BuildOneBatch(stage);
+    }
+}
+
+// Build one batch per task and push the stage back to the tail of the pool queue, so stages share threads fairly when
+// there are fewer threads than stages.
+void NormalTabletBuildPipeline::BuildOneBatch(Stage* stage)
+{
+    std::shared_ptr<BatchContext> context;
+    if (stage->queue.TryPop(context)) {
+        auto workItem = stage->creator(context->batch.get());
+        try {
+            workItem->process();
+        } catch (const autil::legacy::ExceptionBase& e) {
+            AUTIL_LOG(ERROR, "stage [%s] process exception [%s].", stage->name.c_str(), e.what());
+        } catch (const std::exception& e) {
+            AUTIL_LOG(ERROR, "stage [%s] process exception [%s]", stage->name.c_str(), e.what());
+        }
+        workItem.reset();
+        FinishStage(context);
+    }
+    stage->scheduled.store(false, std::memory_order_seq_cst);
+    // without the fence the queue check may be ordered before the store and miss a batch pushed meanwhile, whose
+    // producer still saw the stage scheduled
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!stage->queue.Empty()) {
+        Schedule(stage);
+    }
+}
+
+void NormalTabletBuildPipeline::FinishStage(const std::shared_ptr<BatchContext>& context)
+{
+    if (context->unfinishedStageCount.fetch_sub(1) != 1) {
+        return;
+    }
+    if (context->onFinish) {
+        context->onFinish();
+    }
+    context->batch.reset();
+    std::lock_guard<std::mutex> lock(_finishMutex);
+    if (--_unfinishedBatchCount == 0) {
+        _finishCond.notify_all();
+    }
+}
+
+void NormalTabletBuildPipeline::WaitFinish()
+{
+    std::unique_lock<std::mutex> lock(_finishMutex);
+    _finishCond.wait(lock, [this]() { return _unfinishedBatchCount == 0; });
+}
+
+} // namespace indexlib::table
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "autil/Log.h"
+#include "autil/NoCopyable.h"
+#include "indexlib/util/SpscRingQueue.h"
+
+namespace autil {
+class ThreadPool;
+}
+namespace indexlibv2::document {
+class IDocumentBatch;
+}
+namespace indexlib::index {
+class BuildWorkItem;
+}
+
+namespace indexlib::table {
+
+// Pipelined build of document batches. Every single index builder is one stage with its own ring of batches, the
+// stage builds them in order on at most one thread of the pool at a time and never waits for other stages, so a slow
+// index only delays its own ring. A batch finishes when all stages have built it.
+class NormalTabletBuildPipeline : autil::NoCopyable
+{
+public:
+    using WorkItemCreator =
+        std::function<std::unique_ptr<indexlib::index::BuildWorkItem>(indexlibv2::document::IDocumentBatch*)>;
+
+public:
+    NormalTabletBuildPipeline(const std::shared_ptr<autil::ThreadPool>& threadPool, size_t maxPendingBatchCount);
+    ~NormalTabletBuildPipeline();
+
+public:
+    void AddStage(const std::string& name, WorkItemCreator&& creator);
+    // Block only if the ring of some stage is full. onFinish is run by the stage that builds the batch last.
+    void Push(const std::shared_ptr<indexlibv2::document::IDocumentBatch>& batch, std::function<void()>&& onFinish);
+    void WaitFinish();
+    size_t GetStageCount() const { return _stages.size(); }
+
+private:
+    struct BatchContext {
+        std::shared_ptr<indexlibv2::document::IDocumentBatch> batch;
+        std::atomic<size_t> unfinishedStageCount;
+        std::function<void()> onFinish;
+    };
+    struct Stage {
+        Stage(const std::string& name, WorkItemCreator&& creator, size_t capacity)
+            : name(name)
+            , creator(std::move(creator))
+            , queue(capacity)
+            , scheduled(false)
+        {
+        }
+        std::string name;
+        WorkItemCreator creator;
+        indexlib::util::SpscRingQueue<std::shared_ptr<BatchContext>> queue;
+        std::atomic<bool> scheduled;
+    };
+
+private:
+    void Schedule(Stage* stage);
+    void BuildOneBatch(Stage* stage);
+    void FinishStage(const std::shared_ptr<BatchContext>& context);
+
+private:
+    static constexpr int64_t STAGE_FULL_SLEEP_US = 200;
+
+    std::shared_ptr<autil::ThreadPool> _threadPool;
+    size_t _maxPendingBatchCount;
+    std::vector<std::unique_ptr<Stage>> _stages;
+    std::mutex _finishMutex;
+    std::condition_variable _finishCond;
+    size_t _unfinishedBatchCount;
+
+private:
+    AUTIL_LOG_DECLARE();
+};
+
+} // namespace indexlib::table
@@ -15,6 +15,7 @@
  */
 #include "indexlib/table/normal_table/NormalTabletParallelBuilder.h"
 
+#include "autil/EnvUtil.h"
 #include "autil/ThreadPool.h"
 #include "indexlib/config/TabletSchema.h"
 #include "indexlib/document/IDocumentBatch.h"
@@ -35,6 +36,7 @@
 #include "indexlib/index/summary/config/SummaryIndexConfig.h"
 #include "indexlib/table/normal_table/Common.h"
 #include "indexlib/table/normal_table/NormalMemSegment.h"
+#include "indexlib/table/normal_table/NormalTabletBuildPipeline.h"
 #include "indexlib/table/normal_table/virtual_attribute/SingleVirtualAttributeBuilder.h"
 #include "indexlib/table/normal_table/virtual_attribute/VirtualAttributeBuildWorkItem.h"
 #include "indexlib/util/GroupedThreadPool.h"
@@ -54,6 +56,7 @@ NormalTabletParallelBuilder::NormalTabletParallelBuilder()
     , _consistentModeBuildThreadPool(nullptr)
     , _inconsistentModeBuildThreadPool(nullptr)
 {
+    _enablePipelinedBuild = autil::EnvUtil::getEnv("INDEXLIB_PIPELINED_BATCH_BUILD", false);
 }
 
 NormalTabletParallelBuilder::~NormalTabletParallelBuilder() {}
@@ -148,8 +151,8 @@ Status NormalTabletParallelBuilder::SwitchBuildMode(OpenOptions::BuildMode build
         return Status::OK();
     }
     if (_buildMode != OpenOptions::STREAM) {
-        assert(_buildThreadPool != nullptr);
-        _buildThreadPool->WaitFinish();
+        WaitFinish();
+        _buildPipeline.reset();
     }
     if (buildMode == OpenOptions::CONSISTENT_BATCH) {
         if (_consistentModeBuildThreadPool == nullptr) {
@@ -298,6 +301,67 @@ void NormalTabletParallelBuilder::CreateBuildWorkItems(
     }
 }
 
+template <typename BuilderType, typename BuildWorkItemType>
+void NormalTabletParallelBuilder::AddBuildPipelineStages(
+    const std::vector<std::unique_ptr<BuilderType>>& builders,
+    const std::function<std::string(const BuilderType*)>& stageName)
+{
+    for (const auto& singleBuilder : builders) {
+        BuilderType* builder = singleBuilder.get();
+        _buildPipeline->AddStage(stageName(builder), [builder](indexlibv2::document::IDocumentBatch* batch) {
+            return std::make_unique<BuildWorkItemType>(builder, batch);
+        });
+    }
+}
+
+void NormalTabletParallelBuilder::CreateBuildPipeline()
+{
+    _buildPipeline = std::make_unique<NormalTabletBuildPipeline>(_inconsistentModeBuildThreadPool,
+                                                                 /*maxPendingBatchCount=*/128);
+    AddBuildPipelineStages<
+        indexlib::index::SingleAttributeBuilder<indexlibv2::index::AttributeDiskIndexer,
+                                                indexlibv2::index::AttributeMemIndexer>,
+        index::AttributeBuildWorkItem<indexlibv2::index::AttributeDiskIndexer, indexlibv2::index::AttributeMemIndexer>>(
+        _singleAttributeBuilders, [](const auto* builder) { return "_ATTRIBUTE_" + builder->GetIndexName(); });
+    AddBuildPipelineStages<SingleVirtualAttributeBuilder, VirtualAttributeBuildWorkItem>(
+        _singleVirtualAttributeBuilders,
+        [](const SingleVirtualAttributeBuilder* builder) { return "_ATTRIBUTE_" + builder->GetIndexName(); });
+    AddBuildPipelineStages<indexlib::index::SingleInvertedIndexBuilder, index::InvertedIndexBuildWorkItem>(
+        _singleInvertedIndexBuilders,
+        [](const indexlib::index::SingleInvertedIndexBuilder* builder) {
+            return "_INVERTED_INDEX_" + builder->GetIndexName();
+        });
+    AddBuildPipelineStages<indexlib::index::SingleSummaryBuilder, index::SummaryBuildWorkItem>(
+        _singleSummaryBuilders, [](const indexlib::index::SingleSummaryBuilder*) { return std::string("_SUMMARY_"); });
+    AddBuildPipelineStages<indexlib::index::SingleOperationLogBuilder, index::OperationLogBuildWorkItem>(
+        _singleOpLogBuilders,
+        [](const indexlib::index::SingleOperationLogBuilder*) { return std::string("_OPERATION_LOG_"); });
+    AUTIL_LOG(INFO, "pipelined batch build with [%lu] stages", _buildPipeline->GetStageCount());
+}
+
+// PK / DeletionMap are built in order by the caller so the next batch gets correct docids, other indexes each consume
+// the batches at their own pace. Docs of a batch are released after the slowest index has built it.
+void NormalTabletParallelBuilder::PipelinedBuild(const std::shared_ptr<indexlibv2::document::IDocumentBatch>& batch,
+                                                 int64_t docBatchMemUse)
+{
+    if (_buildPipeline == nullptr) {
+        CreateBuildPipeline();
+    }
+    for (const auto& singleBuilder : _singlePrimaryKeyBuilders) {
+        index::PrimaryKeyBuildWorkItem(singleBuilder.get(), batch.get()).process();
+    }
+    for (const auto& singleBuilder : _singleDeletionMapBuilders) {
+        index::DeletionMapBuildWorkItem(singleBuilder.get(), batch.get()).process();
+    }
+    _normalBuildingSegment->PostBuildActions(batch.get());
+    _buildPipeline->Push(batch, [this, batch, docBatchMemUse]() {
+        for (size_t i = 0; i < batch->GetBatchSize(); ++i) {
+            batch->ReleaseDoc(i);
+        }
+        _docBatchMemController->Free(docBatchMemUse);
+    });
+}
+
 // In CONSISTENT_BATCH build mode, this function will block until Build is complete in all threads.
 // In INCONSISTENT_BATCH build mode, this function will return immediately after necessary
 // build work is done. This will provide better pipelining performance and parallelism. The user can call WaitFinish()
@@ -318,6 +382,13 @@ Status NormalTabletParallelBuilder::Build(const std::shared_ptr<indexlibv2::docu
         _docBatchMemController->AddQuota(docBatchMemUse - _docBatchMemController->GetTotalQuota());
     }
 
+    if (_buildMode == OpenOptions::INCONSISTENT_BATCH && _enablePipelinedBuild) {
+        PipelinedBuild(batch, docBatchMemUse);
+        AUTIL_LOG(INFO, "End pushing batch [%ld] docs to build pipeline, use [%ld] ms", batch->GetBatchSize(),
+                  autil::TimeUtility::currentTimeInMicroSeconds() / 1000 - startTimeInMs);
+        return Status::OK();
+    }
+
     // 索引构建任务
     _buildThreadPool->StartNewBatch();
 
@@ -382,6 +453,9 @@ Status NormalTabletParallelBuilder::Build(const std::shared_ptr<indexlibv2::docu
 
 void NormalTabletParallelBuilder::WaitFinish()
 {
+    if (_buildPipeline != nullptr) {
+        _buildPipeline->WaitFinish();
+    }
     assert(_buildThreadPool != nullptr);
     _buildThreadPool->WaitFinish();
 }
@@ -15,6 +15,9 @@
  */
 #pragma once
 
+#include <functional>
+#include <string>
+
 #include "autil/Log.h"
 #include "autil/NoCopyable.h"
 #include "indexlib/base/Status.h"
@@ -57,6 +60,7 @@ class WaitMemoryQuotaController;
 
 namespace indexlib::table {
 class SingleVirtualAttributeBuilder;
+class NormalTabletBuildPipeline;
 
 // ParallelBuilder does not support offline build mode currently. In offline build mode, update/delete is handled in
 // operation log instead of in built segments. Check NormalTabletWriter::Open for more details.
@@ -96,6 +100,12 @@ private:
     template <typename BuilderType, typename BuildWorkItemType>
     void CreateBuildWorkItems(const std::vector<std::unique_ptr<BuilderType>>& builders,
                               const std::shared_ptr<indexlibv2::document::IDocumentBatch>& batch);
+    // stageName gives the name of the stage of a builder, the same as the name of its build work item
+    template <typename BuilderType, typename BuildWorkItemType>
+    void AddBuildPipelineStages(const std::vector<std::unique_ptr<BuilderType>>& builders,
+                                const std::function<std::string(const BuilderType*)>& stageName);
+    void CreateBuildPipeline();
+    void PipelinedBuild(const std::shared_ptr<indexlibv2::document::IDocumentBatch>& batch, int64_t docBatchMemUse);
     Status ValidateConfigs(const std::shared_ptr<indexlibv2::config::TabletSchema>& schema);
 
 public:
@@ -111,6 +121,8 @@ private:
     std::shared_ptr<autil::ThreadPool> _inconsistentModeBuildThreadPool;
 
     bool _isPreparedForWrite = false;
+    // INCONSISTENT_BATCH mode builds each index in its own pipeline stage instead of grouped batches
+    bool _enablePipelinedBuild = false;
 
     std::vector<std::unique_ptr<indexlib::index::SingleAttributeBuilder<indexlibv2::index::AttributeDiskIndexer,
                                                                         indexlibv2::index::AttributeMemIndexer>>>
@@ -121,6 +133,8 @@ private:
     std::vector<std::unique_ptr<indexlib::index::SingleOperationLogBuilder>> _singleOpLogBuilders;
     std::vector<std::unique_ptr<indexlib::index::ISinglePrimaryKeyBuilder>> _singlePrimaryKeyBuilders;
     std::vector<std::unique_ptr<indexlib::index::SingleDeletionMapBuilder>> _singleDeletionMapBuilders;
+    // destructed first, waits for pending batches before the builders go away
+    std::unique_ptr<NormalTabletBuildPipeline> _buildPipeline;
 
 private:
     AUTIL_LOG_DECLARE();
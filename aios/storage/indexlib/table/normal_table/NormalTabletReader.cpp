@@ -15,6 +15,8 @@
  */
 #include "indexlib/table/normal_table/NormalTabletReader.h"
 
+#include <algorithm>
+
 #include "indexlib/config/TabletSchema.h"
 #include "indexlib/framework/ITabletReader.h"
 #include "indexlib/framework/ResourceMap.h"
@@ -397,6 +399,64 @@ bool NormalTabletReader::GetSortedDocIdRanges(
     return _sortedDocIdRangeSearcher->GetSortedDocIdRanges(dimensions, rangeLimits, resultRanges);
 }
 
+bool NormalTabletReader::HasZoneMap(const std::string& attrName) const
+{
+    auto attrReader = GetIndexReader<index::AttributeReader>(index::ATTRIBUTE_INDEX_TYPE_STR, attrName);
+    return attrReader && attrReader->HasZoneMap();
+}
+
+bool NormalTabletReader::GetZoneMapDocIdRanges(
+    const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>>& dimensions,
+    const DocIdRange& rangeLimit, DocIdRangeVector& resultRanges) const
+{
+    resultRanges.clear();
+    resultRanges.push_back(rangeLimit);
+    bool reduced = false;
+    for (const auto& dimension : dimensions) {
+        auto attrReader = GetIndexReader<index::AttributeReader>(index::ATTRIBUTE_INDEX_TYPE_STR, dimension->name);
+        if (!attrReader || (dimension->ranges.empty() && dimension->values.empty())) {
+            continue;
+        }
+        std::vector<indexlib::index::RangeDescription> rangeDescs = dimension->ranges;
+        for (const auto& value : dimension->values) {
+            rangeDescs.emplace_back(value, value);
+        }
+        // docs of one dimension match any range desc, and docs of all dimensions are intersected
+        DocIdRangeVector dimensionRanges;
+        bool supported = true;
+        for (const auto& limit : resultRanges) {
+            for (const auto& rangeDesc : rangeDescs) {
+                DocIdRangeVector pieceRanges;
+                if (!attrReader->GetZoneMapDocIdRanges(rangeDesc, limit, pieceRanges)) {
+                    supported = false;
+                    break;
+                }
+                dimensionRanges.insert(dimensionRanges.end(), pieceRanges.begin(), pieceRanges.end());
+            }
+            if (!supported) {
+                break;
+            }
+        }
+        if (!supported) {
+            continue;
+        }
+        std::sort(dimensionRanges.begin(), dimensionRanges.end());
+        resultRanges.clear();
+        for (const auto& range : dimensionRanges) {
+            if (range.second <= range.first) {
+                continue;
+            }
+            if (!resultRanges.empty() && resultRanges.back().second >= range.first) {
+                resultRanges.back().second = std::max(resultRanges.back().second, range.second);
+            } else {
+                resultRanges.push_back(range);
+            }
+        }
+        reduced = true;
+    }
+    return reduced;
+}
+
 bool NormalTabletReader::GetPartedDocIdRanges(const DocIdRangeVector& rangeHint, size_t totalWayCount, size_t wayIdx,
                                               DocIdRangeVector& ranges) const
 {
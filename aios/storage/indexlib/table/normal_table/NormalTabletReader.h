@@ -84,6 +84,11 @@ public:
 
     bool GetSortedDocIdRanges(const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>>& dimensions,
                               const DocIdRange& rangeLimits, DocIdRangeVector& resultRanges) const;
+    // resultRanges hold docs which may match all dimensions, judged by attribute zone maps
+    bool GetZoneMapDocIdRanges(const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>>& dimensions,
+                               const DocIdRange& rangeLimit, DocIdRangeVector& resultRanges) const;
+    // building segments have no zone map, only built segments of attribute may skip blocks
+    bool HasZoneMap(const std::string& attrName) const;
     bool GetPartedDocIdRanges(const DocIdRangeVector& rangeHint, size_t totalWayCount, size_t wayIdx,
                               DocIdRangeVector& ranges) const;
     bool GetPartedDocIdRanges(const DocIdRangeVector& rangeHint, size_t totalWayCount,
@@ -67,6 +67,14 @@ public:
         return _impl->GetSortedDocIdRanges(dimensions, rangeLimits, resultRanges);
     }
 
+    bool GetZoneMapDocIdRanges(const std::vector<std::shared_ptr<indexlib::table::DimensionDescription>>& dimensions,
+                               const DocIdRange& rangeLimit, DocIdRangeVector& resultRanges) const
+    {
+        return _impl->GetZoneMapDocIdRanges(dimensions, rangeLimit, resultRanges);
+    }
+
+    bool HasZoneMap(const std::string& attrName) const { return _impl->HasZoneMap(attrName); }
+
     bool GetPartedDocIdRanges(const DocIdRangeVector& rangeHint, size_t totalWayCount, size_t wayIdx,
                               DocIdRangeVector& ranges) const
     {
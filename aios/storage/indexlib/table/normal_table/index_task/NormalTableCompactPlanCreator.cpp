@@ -100,7 +100,7 @@ NormalTableCompactPlanCreator::CreateTaskPlan(const framework::IndexTaskContext*
     auto tabletSchema = taskContext->GetTabletSchema();
 
     NormalTableMergeDescriptionCreator decriptionCreator(tabletSchema, mergeStrategy->GetName(), compactionType,
-                                                         optimize);
+                                                         optimize, mergeConfig.GetMergeTermRangeCount());
     assert(tabletSchema);
     auto [st, sortDescs] = tabletSchema->GetSetting<config::SortDescriptions>("sort_descriptions");
     auto [status1, operationDescriptions] = decriptionCreator.CreateMergeOperationDescriptions(mergePlan);
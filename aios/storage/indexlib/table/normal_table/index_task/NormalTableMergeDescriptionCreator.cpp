@@ -33,9 +33,10 @@ AUTIL_LOG_SETUP(indexlib.table, NormalTableMergeDescriptionCreator);
 
 NormalTableMergeDescriptionCreator::NormalTableMergeDescriptionCreator(
     const std::shared_ptr<config::TabletSchema>& schema, const std::string& mergeStrategy,
-    const std::string& compactionType, bool isOptimizeMerge)
+    const std::string& compactionType, bool isOptimizeMerge, uint32_t termRangeCount)
     : CommonMergeDescriptionCreator(schema)
     , _isOptimizeMerge(isOptimizeMerge)
+    , _termRangeCount(termRangeCount)
     , _compactionType(compactionType)
     , _mergeStrategy(mergeStrategy)
 {
@@ -86,6 +87,9 @@ NormalTableMergeDescriptionCreator::CreateIndexMergeOperationDescription(
             opDesc.AddDepend(_bucketMapOpId);
         }
     }
+    if (invertedIndexConfig != nullptr && _termRangeCount > 1) {
+        opDesc.AddParameter(indexlib::index::MERGE_TERM_RANGE_COUNT, std::to_string(_termRangeCount));
+    }
 
     opDesc.AddParameter(indexlib::index::OPTIMIZE_MERGE, _isOptimizeMerge);
     return std::make_pair(Status::OK(), opDesc);
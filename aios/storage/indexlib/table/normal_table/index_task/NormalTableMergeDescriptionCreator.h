@@ -27,7 +27,7 @@ class NormalTableMergeDescriptionCreator : public CommonMergeDescriptionCreator
 public:
     NormalTableMergeDescriptionCreator(const std::shared_ptr<config::TabletSchema>& schema,
                                        const std::string& mergeStrategy, const std::string& compactionType,
-                                       bool isOptimizeMerge);
+                                       bool isOptimizeMerge, uint32_t termRangeCount = 1);
     ~NormalTableMergeDescriptionCreator();
 
 public:
@@ -55,6 +55,7 @@ protected:
 private:
     bool _isSortedMerge = false;
     bool _isOptimizeMerge = false;
+    uint32_t _termRangeCount = 1;
     framework::IndexOperationId _bucketMapOpId = framework::INVALID_INDEX_OPERATION_ID;
     std::string _compactionType = NORMAL_TABLE_MERGE_TYPE;
     std::string _mergeStrategy;
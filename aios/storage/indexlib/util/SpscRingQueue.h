@@ -0,0 +1,98 @@
+/*
+ * Copyright 2014-present Alibaba Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "autil/NoCopyable.h"
+
+namespace indexlib::util {
+
+// bounded lock-free ring for exactly one producer thread and one consumer thread at a time.
+template <typename T>
+class SpscRingQueue : private autil::NoCopyable
+{
+public:
+    explicit SpscRingQueue(size_t capacity);
+    ~SpscRingQueue() = default;
+
+public:
+    // producer side, return false when the ring is full
+    bool TryPush(const T& item);
+    // consumer side, return false when the ring is empty
+    bool TryPop(T& item);
+
+    size_t Size() const { return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire); }
+    bool Empty() const { return Size() == 0; }
+    size_t Capacity() const { return _items.size(); }
+
+private:
+    static size_t RoundUpPowerOf2(size_t n);
+
+private:
+    std::vector<T> _items;
+    size_t _mask;
+    alignas(64) std::atomic<size_t> _head; // next slot to pop
+    alignas(64) std::atomic<size_t> _tail; // next slot to push
+};
+
+template <typename T>
+SpscRingQueue<T>::SpscRingQueue(size_t capacity)
+    : _items(RoundUpPowerOf2(capacity))
+    , _mask(_items.size() - 1)
+    , _head(0)
+    , _tail(0)
+{
+}
+
+template <typename T>
+bool SpscRingQueue<T>::TryPush(const T& item)
+{
+    size_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _head.load(std::memory_order_acquire) >= _items.size()) {
+        return false;
+    }
+    _items[tail & _mask] = item;
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool SpscRingQueue<T>::TryPop(T& item)
+{
+    size_t head = _head.load(std::memory_order_relaxed);
+    if (head == _tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+    item = std::move(_items[head & _mask]);
+    _items[head & _mask] = T();
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+size_t SpscRingQueue<T>::RoundUpPowerOf2(size_t n)
+{
+    size_t capacity = 1;
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+} // namespace indexlib::util
@@ -136,10 +136,15 @@ void GraphDomainRemoteBase::send(NaviPartId partId) {
 bool GraphDomainRemoteBase::collectData(NaviPartId partId,
                                         NaviMessage &naviMessage)
 {
+    size_t messageBytes = 0;
     for (const auto &pair : _remoteInputBorderMap) {
+        if (SubGraphBorder::messageFull(messageBytes)) {
+            // left over data triggers another round in send()
+            break;
+        }
         const auto &border = pair.second;
         NaviBorderData borderData;
-        if (!border->collectBorderMessage(partId, borderData)) {
+        if (!border->collectBorderMessage(partId, borderData, messageBytes)) {
             return false;
         }
         if (0 == borderData.port_datas_size()) {
@@ -36,6 +36,10 @@ void KernelComputeEvent::fillProto(KernelComputeEventDef *event,
     event->set_majflt(majflt);
     event->set_pool_malloc_count(poolMallocCount);
     event->set_pool_malloc_size(poolMallocSize);
+    event->set_cycles(counter.cycles);
+    event->set_instructions(counter.instructions);
+    event->set_cache_misses(counter.cacheMisses);
+    event->set_branch_misses(counter.branchMisses);
     if (perfResult) {
         perfResult->fillProto(event->mutable_perf(), addrMap);
     }
@@ -107,6 +111,10 @@ void KernelMetric::reportTime(int32_t type,
     event.poolMallocCount = poolMallocCount;
     event.poolMallocSize = poolMallocSize;
     event.perfResult = perfResult;
+    if (perfResult) {
+        event.counter = perfResult->getCounter();
+        _counter += event.counter;
+    }
     _queueLatencyNs += event.queueTime();
     _computeLatencyNs += event.computeTime();
     _eventList.emplace_back(event);
@@ -120,6 +128,10 @@ int64_t KernelMetric::totalLatencyUs() const {
     return _computeLatencyNs / 1000;
 }
 
+const NaviPerfCounter &KernelMetric::counter() const {
+    return _counter;
+}
+
 void KernelMetric::fillProto(KernelMetricDef *metric,
                              std::unordered_map<uint64_t, uint32_t> &addrMap) const
 {
@@ -130,6 +142,10 @@ void KernelMetric::fillProto(KernelMetricDef *metric,
     metric->set_try_schedule_count(_tryScheduleCount);
     metric->set_queue_latency_us(queueLatencyUs());
     metric->set_compute_latency_us(totalLatencyUs());
+    metric->set_cycles(_counter.cycles);
+    metric->set_instructions(_counter.instructions);
+    metric->set_cache_misses(_counter.cacheMisses);
+    metric->set_branch_misses(_counter.branchMisses);
 
     for (const auto &event : _eventList) {
         event.fillProto(metric->add_events(), addrMap);
@@ -177,7 +193,11 @@ std::string KernelMetric::toString() const {
            + ", scheduleCount: " + autil::StringUtil::toString(_scheduleCount)
            + ", tryScheduleCount: " + autil::StringUtil::toString(_tryScheduleCount)
            + ", queueLatency: " + autil::StringUtil::toString(queueLatencyUs())
-           + ", totalLatencyUs: " + autil::StringUtil::toString(totalLatencyUs());
+           + ", totalLatencyUs: " + autil::StringUtil::toString(totalLatencyUs())
+           + ", cycles: " + autil::StringUtil::toString(_counter.cycles)
+           + ", instructions: " + autil::StringUtil::toString(_counter.instructions)
+           + ", cacheMisses: " + autil::StringUtil::toString(_counter.cacheMisses)
+           + ", branchMisses: " + autil::StringUtil::toString(_counter.branchMisses);
     ret += "\ntimeline: \n";
     for (const auto &event : _eventList) {
         ret += "enqueue: " +
@@ -84,6 +84,8 @@ public:
     int64_t majflt;
     int64_t poolMallocCount;
     int64_t poolMallocSize;
+    // local only, not part of the serialized layout
+    NaviPerfCounter counter;
     NaviPerfResultPtr perfResult;
 };
 
@@ -111,6 +113,7 @@ public:
     int64_t tryScheduleCount() const;
     int64_t queueLatencyUs() const;
     int64_t totalLatencyUs() const;
+    const NaviPerfCounter &counter() const;
     inline int64_t getMicroSecond(const timeval &val) const {
         return val.tv_sec * 1000000 + val.tv_usec;
     }
@@ -129,6 +132,8 @@ public:
     int64_t _tryScheduleCount;
     int64_t _queueLatencyNs;
     int64_t _computeLatencyNs;
+    // local only, not part of the serialized layout
+    NaviPerfCounter _counter;
     std::list<KernelComputeEvent> _eventList;
 };
 
@@ -15,6 +15,7 @@
  */
 #include "navi/engine/NaviMetricsGroup.h"
 #include "navi/engine/NaviSnapshotStat.h"
+#include "autil/metric/QueryLatencyRecorder.h"
 #include "kmonitor/client/MetricMacro.h"
 #include "kmonitor/client/core/MutableMetric.h"
 
@@ -43,6 +44,9 @@ void RunGraphMetrics::report(const kmonitor::MetricsTags *tags,
     }
     if (collector->fillResultTime) {
         REPORT_MUTABLE_METRIC(_latency, (collector->fillResultTime - collector->createTime) / 1000);
+        // realtime builders in this process throttle themselves by the query latency
+        autil::metric::QueryLatencyRecorder::getInstance()->record(
+                (collector->fillResultTime - collector->createTime) / 1000.0);
         REPORT_MUTABLE_METRIC(_naviRunLatency,
                               (collector->fillResultTime - collector->initScheduleTime) / 1000);
     }
@@ -31,7 +31,8 @@ void RemoteOutputPort::setCallback(NaviPartId partId, bool eof) {
 }
 
 void RemoteOutputPort::getCallback(NaviPartId partId, bool eof) {
-    // schedule remote input
+    // no credit is returned to the remote input, see
+    // SubGraphBorder::MAX_STREAM_MESSAGE_BYTES
 }
 
 }
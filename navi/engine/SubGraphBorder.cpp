@@ -416,15 +416,19 @@ void SubGraphBorder::notifySend(NaviPartId partId) {
 }
 
 bool SubGraphBorder::collectBorderMessage(NaviPartId partId,
-                                          NaviBorderData &borderMessage)
+                                          NaviBorderData &borderMessage,
+                                          size_t &messageBytes)
 {
     if (GDT_CLIENT == _domain->getType()) {
-        if (!doCollectBorderMessage(partId, borderMessage)) {
+        if (!doCollectBorderMessage(partId, borderMessage, messageBytes)) {
             return false;
         }
     } else {
         for (auto partId : _partInfo) {
-            if (!doCollectBorderMessage(partId, borderMessage)) {
+            if (messageFull(messageBytes)) {
+                break;
+            }
+            if (!doCollectBorderMessage(partId, borderMessage, messageBytes)) {
                 return false;
             }
         }
@@ -436,22 +440,28 @@ bool SubGraphBorder::collectBorderMessage(NaviPartId partId,
 }
 
 bool SubGraphBorder::doCollectBorderMessage(NaviPartId partId,
-                                            NaviBorderData &borderMessage)
+                                            NaviBorderData &borderMessage,
+                                            size_t &messageBytes)
 {
     assert(!isLocalBorder());
     assert(IOT_INPUT == _borderId.ioType);
     NAVI_LOG(SCHEDULE2, "remote domain trigger write, partId[%d]", partId);
-    while (_borderState.messageCount(partId) > 0) {
-        if (!collect(partId, borderMessage)) {
+    while (_borderState.messageCount(partId) > 0 && !messageFull(messageBytes)) {
+        if (!collect(partId, borderMessage, messageBytes)) {
             return false;
         }
     }
     return true;
 }
 
-bool SubGraphBorder::collect(NaviPartId partId, NaviBorderData &borderMessage) {
+bool SubGraphBorder::collect(NaviPartId partId, NaviBorderData &borderMessage,
+                             size_t &messageBytes)
+{
     for (auto port : _portVec) {
-        auto ec = collectPortData(port, partId, borderMessage);
+        if (messageFull(messageBytes)) {
+            break;
+        }
+        auto ec = collectPortData(port, partId, borderMessage, messageBytes);
         if (EC_NONE != ec) {
             return false;
         }
@@ -460,12 +470,13 @@ bool SubGraphBorder::collect(NaviPartId partId, NaviBorderData &borderMessage) {
 }
 
 ErrorCode SubGraphBorder::collectPortData(Port *port, NaviPartId partId,
-                                          NaviBorderData &borderMessage)
+                                          NaviBorderData &borderMessage,
+                                          size_t &messageBytes)
 {
     assert(port);
     ErrorCode ec = EC_NONE;
     auto portId = port->getPortId();
-    while (EC_NO_DATA != ec) {
+    while (EC_NO_DATA != ec && !messageFull(messageBytes)) {
         NaviPortData data;
         bool eof = false;
         ec = port->getData(partId, data, eof);
@@ -487,6 +498,7 @@ ErrorCode SubGraphBorder::collectPortData(Port *port, NaviPartId partId,
                 return EC_UNKNOWN;
             }
         }
+        messageBytes += data.data().size();
         auto dataPb = borderMessage.add_port_datas();
         dataPb->Swap(&data);
         dataPb->set_port_id(portId);
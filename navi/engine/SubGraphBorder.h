@@ -50,7 +50,8 @@ public:
     const std::vector<Port *> &getPortVec() const;
 public:
     void notifySend(NaviPartId partId);
-    bool collectBorderMessage(NaviPartId partId, NaviBorderData &borderMessage);
+    bool collectBorderMessage(NaviPartId partId, NaviBorderData &borderMessage,
+                              size_t &messageBytes);
     bool receive(NaviBorderData &borderData);
     void incMessageCount(NaviPartId partId);
     void decMessageCount(NaviPartId partId);
@@ -65,10 +66,13 @@ private:
     void initPortIndexMap();
     bool initBorderState(NaviPartId partCount);
     bool doCollectBorderMessage(NaviPartId partId,
-                                NaviBorderData &borderMessage);
-    bool collect(NaviPartId partId, NaviBorderData &borderMessage);
+                                NaviBorderData &borderMessage,
+                                size_t &messageBytes);
+    bool collect(NaviPartId partId, NaviBorderData &borderMessage,
+                 size_t &messageBytes);
     ErrorCode collectPortData(Port *port, NaviPartId partId,
-                              NaviBorderData &borderMessage);
+                              NaviBorderData &borderMessage,
+                              size_t &messageBytes);
     void fillBorderId(NaviBorderData &borderData);
     bool getBorderConnectInfo(const SubGraphBorder &toBorder,
                               BorderConnectInfo &connectInfo) const;
@@ -92,6 +96,17 @@ public:
     ErrorCode setEof(NaviPartId fromPartId);
 public:
     friend std::ostream& operator<<(std::ostream& os, const SubGraphBorder& subBorder);
+public:
+    // a single stream message stops collecting port data once it reaches
+    // this size, remaining data is shipped by the next message so that the
+    // peer can start consuming the first batches early.
+    // this is chunking only, there is no flow control between borders: ports
+    // never block the producer (LocalOutputPort is always ready), and a client
+    // sends eof together with its inputs, leaving no channel for acks.
+    static constexpr size_t MAX_STREAM_MESSAGE_BYTES = 4 * 1024 * 1024;
+    static bool messageFull(size_t messageBytes) {
+        return messageBytes >= MAX_STREAM_MESSAGE_BYTES;
+    }
 private:
     DECLARE_LOGGER();
     GraphParam *_param;
@@ -205,6 +205,10 @@ size_t NaviPerfResult::getEventCount() const {
     return _eventCount;
 }
 
+const NaviPerfCounter &NaviPerfResult::getCounter() const {
+    return _counter;
+}
+
 uint64_t NaviPerfResult::getSampleTime(NaviPerfEventEntry *entry) {
     switch (entry->sampleType) {
     case PET_SAMPLE:
@@ -103,6 +103,43 @@ public:
     };
 };
 
+// hardware counters read around a single kernel compute, only
+// available when the pmu supports them. they stay in the local
+// process (proto/perf output) and are not part of the rpc layout.
+// cacheMisses is the generic PERF_COUNT_HW_CACHE_MISSES event, which
+// the pmu driver maps to whatever cache level it chooses
+struct NaviPerfCounter {
+public:
+    NaviPerfCounter()
+        : cycles(0)
+        , instructions(0)
+        , cacheMisses(0)
+        , branchMisses(0)
+    {
+    }
+    NaviPerfCounter &operator-=(const NaviPerfCounter &other) {
+        cycles -= other.cycles;
+        instructions -= other.instructions;
+        cacheMisses -= other.cacheMisses;
+        branchMisses -= other.branchMisses;
+        return *this;
+    }
+    NaviPerfCounter &operator+=(const NaviPerfCounter &other) {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        cacheMisses += other.cacheMisses;
+        branchMisses += other.branchMisses;
+        return *this;
+    }
+public:
+    int64_t cycles;
+    int64_t instructions;
+    int64_t cacheMisses;
+    int64_t branchMisses;
+public:
+    static constexpr size_t COUNTER_COUNT = 4;
+};
+
 class NaviPerfThread;
 class NaviPerfResult;
 NAVI_TYPEDEF_PTR(NaviPerfResult);
@@ -122,6 +159,7 @@ public:
     int addEntry(NaviPerfEventEntry *entry);
     void stop();
     size_t getEventCount() const;
+    const NaviPerfCounter &getCounter() const;
     void fillProto(KernelPerfDef *perf,
                    std::unordered_map<uint64_t, uint32_t> &addrMap) const;
 public:
@@ -138,6 +176,7 @@ private:
     size_t _eventCount;
     NaviPerfEventEntry *_head;
     NaviPerfEventEntry *_tail;
+    NaviPerfCounter _counter;
 };
 
 }
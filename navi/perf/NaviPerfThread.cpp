@@ -39,6 +39,9 @@ NaviPerfThread::NaviPerfThread(pid_t pid)
     , _fd(-1)
     , _mem(MAP_FAILED)
 {
+    for (auto &fd : _counterFds) {
+        fd = -1;
+    }
 }
 
 NaviPerfThread::~NaviPerfThread() {
@@ -48,6 +51,11 @@ NaviPerfThread::~NaviPerfThread() {
     if (MAP_FAILED != _mem) {
         munmap(_mem, _mmapSize);
     }
+    for (auto fd : _counterFds) {
+        if (-1 != fd) {
+            ::close(fd);
+        }
+    }
     auto result = _resultEndList;
     while (result) {
         result = result->stealPrev();
@@ -77,6 +85,70 @@ bool NaviPerfThread::init(const NaviLoggerPtr &logger) {
         return false;
     }
     ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+    initCounter();
+    return true;
+}
+
+void NaviPerfThread::initCounter() {
+    // order must match NaviPerfCounter fields, cycles is the group leader
+    static constexpr uint64_t configs[NaviPerfCounter::COUNTER_COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+    };
+    for (size_t i = 0; i < NaviPerfCounter::COUNTER_COUNT; i++) {
+        auto fd = openCounter(configs[i], _counterFds[0]);
+        if (-1 == fd) {
+            NAVI_LOG(WARN,
+                     "open hardware counter [%lu] for pid [%d] failed, "
+                     "error [%s], counters disabled",
+                     configs[i], _pid, strerror(errno));
+            for (auto &counterFd : _counterFds) {
+                if (-1 != counterFd) {
+                    ::close(counterFd);
+                    counterFd = -1;
+                }
+            }
+            return;
+        }
+        _counterFds[i] = fd;
+    }
+    ioctl(_counterFds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+}
+
+int NaviPerfThread::openCounter(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(perf_event_attr));
+    attr.size = sizeof(perf_event_attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = (-1 == groupFd) ? 1 : 0;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.exclude_guest = 1;
+    return syscall(__NR_perf_event_open, &attr, _pid, -1, groupFd,
+                   PERF_FLAG_FD_CLOEXEC);
+}
+
+bool NaviPerfThread::readCounter(NaviPerfCounter &counter) const {
+    auto leaderFd = _counterFds[0];
+    if (-1 == leaderFd) {
+        return false;
+    }
+    // PERF_FORMAT_GROUP layout: nr, value[nr]
+    uint64_t buffer[1 + NaviPerfCounter::COUNTER_COUNT];
+    auto ret = ::read(leaderFd, buffer, sizeof(buffer));
+    if (ret != (ssize_t)sizeof(buffer) ||
+        buffer[0] != NaviPerfCounter::COUNTER_COUNT)
+    {
+        return false;
+    }
+    counter.cycles = buffer[1];
+    counter.instructions = buffer[2];
+    counter.cacheMisses = buffer[3];
+    counter.branchMisses = buffer[4];
     return true;
 }
 
@@ -122,16 +194,23 @@ bool NaviPerfThread::enable() {
     if (0 != ret) {
         NAVI_LOG(ERROR, "begin thread sample error");
     }
+    if (-1 != _counterFds[0]) {
+        ioctl(_counterFds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
     flushLBR(0);
     return ret;
 }
 
 bool NaviPerfThread::disable() {
+    if (-1 != _counterFds[0]) {
+        ioctl(_counterFds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
     return ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
 }
 
 bool NaviPerfThread::beginSample() {
     NaviPerfResultPtr newResult(new NaviPerfResult());
+    readCounter(newResult->_counter);
     pushQueue(_resultQueue, newResult);
     newResult->setPrev(_resultEndList);
     _resultEndList = newResult;
@@ -146,6 +225,13 @@ NaviPerfResultPtr NaviPerfThread::endSample() {
     auto retResult = _resultEndList;
     _resultEndList = _resultEndList->stealPrev();
     if (retResult) {
+        NaviPerfCounter endCounter;
+        if (readCounter(endCounter)) {
+            endCounter -= retResult->_counter;
+            retResult->_counter = endCounter;
+        } else {
+            retResult->_counter = NaviPerfCounter();
+        }
         retResult->stop();
     }
     NAVI_LOG(SCHEDULE2, "end thread sample, %lu", retResult->getEventCount());
@@ -39,6 +39,9 @@ public:
     void sample();
 private:
     void initPerfAttr();
+    void initCounter();
+    int openCounter(uint64_t config, int groupFd);
+    bool readCounter(NaviPerfCounter &counter) const;
     int perf_event_open(int cpu, int groupFd, unsigned long flags);
     NaviPerfResultPtr getResult() const;
     void setResult(const NaviPerfResultPtr &newResult);
@@ -57,6 +60,7 @@ private:
     size_t _mmapSize;
     int _fd;
     void *_mem;
+    int _counterFds[NaviPerfCounter::COUNTER_COUNT];
     arpc::common::LockFreeQueue<NaviPerfResultPtr> _resultQueue;
     arpc::common::LockFreeQueue<NaviPerfResultPtr> _mainQueue;
     NaviPerfResultPtr _resultQueueTail;